@@ -9,6 +9,7 @@
 #include "autopick/autopick-dirty-flags.h"
 #include "autopick/autopick-entry.h"
 #include "autopick/autopick-matcher.h"
+#include "autopick/autopick-rule-index.h"
 #include "autopick/autopick-util.h"
 #include "flavor/flavor-describer.h"
 #include "flavor/object-flavor-types.h"
@@ -31,22 +32,11 @@
  * @details
  * A function for Auto-picker/destroyer
  * Examine whether the object matches to the list of keywords or not.
+ * 検索には前処理した索引 (AutopickRuleIndex) を用いる.
  */
 int find_autopick_list(PlayerType *player_ptr, const ItemEntity *o_ptr)
 {
-    if (o_ptr->bi_key.tval() == ItemKindType::GOLD) {
-        return -1;
-    }
-
-    const auto item_name = str_tolower(describe_flavor(player_ptr, *o_ptr, (OD_NO_FLAVOR | OD_OMIT_PREFIX | OD_NO_PLURAL)));
-    for (auto i = 0U; i < autopick_list.size(); i++) {
-        const auto &entry = autopick_list[i];
-        if (is_autopick_match(player_ptr, o_ptr, entry, item_name)) {
-            return i;
-        }
-    }
-
-    return -1;
+    return AutopickRuleIndex::get_instance().find(player_ptr, *o_ptr);
 }
 
 /*!
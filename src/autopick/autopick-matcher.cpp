@@ -21,28 +21,37 @@
 #include "player-base/player-class.h"
 #include "player/player-realm.h"
 #include "system/baseitem/baseitem-definition.h"
+#include "system/baseitem/baseitem-key.h"
 #include "system/floor/floor-info.h"
 #include "system/item-entity.h"
 #include "system/monrace/monrace-definition.h"
 #include "system/player-type-definition.h"
 #include "util/string-processor.h"
 
-static bool check_item_features(PlayerType *player_ptr, const autopick_type &entry, const ItemEntity &item, const ItemKindType tval)
+/*!
+ * @brief アイテムの種別が自動拾いエントリの種別指定 (「武器」「鎧」など) に合うかを調べる
+ * @param entry 自動拾いのエントリ
+ * @param tval アイテムの種別
+ * @return 合うならばtrue
+ * @details 「得意武器」はクラスや熟練度にもよるので、ここでは近接武器か否かだけを調べる.
+ */
+bool is_autopick_kind_match(const autopick_type &entry, const ItemKindType tval)
 {
+    const BaseitemKey bi_key(tval);
     if (entry.has(FLG_WEAPONS)) {
-        return item.is_weapon();
+        return bi_key.is_weapon();
     }
 
     if (entry.has(FLG_FAVORITE_WEAPONS)) {
-        return object_is_favorite(player_ptr, &item);
+        return bi_key.is_melee_weapon();
     }
 
     if (entry.has(FLG_ARMORS)) {
-        return item.is_protector();
+        return bi_key.is_protector();
     }
 
     if (entry.has(FLG_MISSILES)) {
-        return item.is_ammo();
+        return bi_key.is_ammo();
     }
 
     if (entry.has(FLG_DEVICES)) {
@@ -78,7 +87,7 @@ static bool check_item_features(PlayerType *player_ptr, const autopick_type &ent
     }
 
     if (entry.has(FLG_SPELLBOOKS)) {
-        return item.is_spell_book();
+        return bi_key.is_spell_book();
     }
 
     if (entry.has(FLG_HAFTED)) {
@@ -102,7 +111,7 @@ static bool check_item_features(PlayerType *player_ptr, const autopick_type &ent
     }
 
     if (entry.has(FLG_SUITS)) {
-        return item.is_armour();
+        return bi_key.is_armour();
     }
 
     if (entry.has(FLG_CLOAKS)) {
@@ -124,10 +133,40 @@ static bool check_item_features(PlayerType *player_ptr, const autopick_type &ent
     return true;
 }
 
+static bool check_item_features(PlayerType *player_ptr, const autopick_type &entry, const ItemEntity &item)
+{
+    if (!entry.has(FLG_WEAPONS) && entry.has(FLG_FAVORITE_WEAPONS)) {
+        return object_is_favorite(player_ptr, &item);
+    }
+
+    return is_autopick_kind_match(entry, item.bi_key.tval());
+}
+
+/*!
+ * @brief アイテムの名前が自動拾いエントリの名前に一致するかを調べる
+ */
+static bool check_item_name(const autopick_type &entry, std::string_view item_name)
+{
+    if (entry.name[0] == '^') {
+        return item_name.starts_with(std::string_view(entry.name).substr(1));
+    }
+
+    return str_find(std::string(item_name), entry.name);
+}
+
 /*!
  * @brief A function for Auto-picker/destroyer Examine whether the object matches to the entry
  */
 bool is_autopick_match(PlayerType *player_ptr, const ItemEntity *o_ptr, const autopick_type &entry, std::string_view item_name)
+{
+    return check_item_name(entry, item_name) && is_autopick_match_except_name(player_ptr, o_ptr, entry);
+}
+
+/*!
+ * @brief アイテムが自動拾いエントリの名前以外の条件を満たすかを調べる
+ * @details 名前の一致は呼び出し元で調べ終えている場合に使う.
+ */
+bool is_autopick_match_except_name(PlayerType *player_ptr, const ItemEntity *o_ptr, const autopick_type &entry)
 {
     if (entry.has(FLG_UNAWARE) && o_ptr->is_aware()) {
         return false;
@@ -344,20 +383,10 @@ bool is_autopick_match(PlayerType *player_ptr, const ItemEntity *o_ptr, const au
         return false;
     }
 
-    if (!check_item_features(player_ptr, entry, *o_ptr, tval)) {
+    if (!check_item_features(player_ptr, entry, *o_ptr)) {
         return false;
     }
 
-    if (entry.name[0] == '^') {
-        if (!item_name.starts_with(std::string_view(entry.name).substr(1))) {
-            return false;
-        }
-    } else {
-        if (!str_find(std::string(item_name), entry.name)) {
-            return false;
-        }
-    }
-
     if (!entry.has(FLG_COLLECTING)) {
         return true;
     }
@@ -3,7 +3,10 @@
 #include "system/angband.h"
 #include <string_view>
 
+enum class ItemKindType : short;
 struct autopick_type;
 class ItemEntity;
 class PlayerType;
+bool is_autopick_kind_match(const autopick_type &entry, ItemKindType tval);
 bool is_autopick_match(PlayerType *player_ptr, const ItemEntity *o_ptr, const autopick_type &entry, std::string_view item_name);
+bool is_autopick_match_except_name(PlayerType *player_ptr, const ItemEntity *o_ptr, const autopick_type &entry);
@@ -9,6 +9,7 @@
 #include "autopick/autopick-finder.h"
 #include "autopick/autopick-methods-table.h"
 #include "autopick/autopick-reader-writer.h"
+#include "autopick/autopick-rule-index.h"
 #include "autopick/autopick-util.h"
 #include "core/asking-player.h"
 #include "flavor/flavor-describer.h"
@@ -186,6 +187,7 @@ bool autopick_autoregister(PlayerType *player_ptr, const ItemEntity *o_ptr)
     autopick_entry_from_object(player_ptr, entry, o_ptr);
     entry->action = DO_AUTODESTROY;
     autopick_list.push_back(*entry);
+    AutopickRuleIndex::get_instance().invalidate();
 
     const auto line = autopick_line_from_entry(*entry);
     fprintf(pref_fff, "%s\n", line.data());
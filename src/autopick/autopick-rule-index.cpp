@@ -0,0 +1,175 @@
+/*!
+ * @file autopick-rule-index.cpp
+ * @brief 自動拾いのエントリを検索用に前処理した索引の実装
+ */
+
+#include "autopick/autopick-rule-index.h"
+#include "autopick/autopick-flags-table.h"
+#include "autopick/autopick-matcher.h"
+#include "autopick/autopick-util.h"
+#include "flavor/flavor-describer.h"
+#include "flavor/object-flavor-types.h"
+#include "system/item-entity.h"
+#include "util/string-processor.h"
+#include "world/world.h"
+
+AutopickRuleIndex &AutopickRuleIndex::get_instance()
+{
+    static AutopickRuleIndex instance;
+    return instance;
+}
+
+/*!
+ * @brief autopick_list が変更されたことを通知する. 索引は次の検索時に作り直す
+ */
+void AutopickRuleIndex::invalidate()
+{
+    this->generation++;
+}
+
+/*!
+ * @brief アイテムに一致する自動拾いのエントリを検索する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param item 検索するアイテム
+ * @return 一致したエントリの番号. なければ-1
+ */
+int AutopickRuleIndex::find(PlayerType *player_ptr, const ItemEntity &item)
+{
+    return this->evaluate(player_ptr, item).index;
+}
+
+/*!
+ * @brief アイテムに一致する自動拾いのエントリを、以前の検索結果を使い回して検索する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param item 検索するアイテム
+ * @return 一致したエントリの番号. なければ-1
+ * @details 同じゲームターンの間は、鑑定状態や名前に表れる値が変わらない限り前回の結果を返す.
+ * プレイヤーの状態の変化は次のターンまで反映されないことがあるので、画面表示にだけ用いること.
+ */
+int AutopickRuleIndex::find_cached(PlayerType *player_ptr, const ItemEntity &item)
+{
+    const auto game_turn = AngbandWorld::get_instance().game_turn;
+    if ((this->compiled_generation != this->generation) || (this->cached_turn != game_turn)) {
+        this->cache.clear();
+        this->cached_turn = game_turn;
+    }
+
+    auto state = get_item_state(item);
+    const auto it = this->cache.find(&item);
+    if ((it != this->cache.end()) && (it->second.first == state)) {
+        return it->second.second;
+    }
+
+    const auto result = this->evaluate(player_ptr, item);
+    if (result.is_cacheable) {
+        this->cache.insert_or_assign(&item, std::make_pair(std::move(state), result.index));
+    } else {
+        this->cache.erase(&item);
+    }
+
+    return result.index;
+}
+
+void AutopickRuleIndex::compile()
+{
+    this->rules.clear();
+    this->buckets.clear();
+    this->cache.clear();
+    this->matcher.clear();
+    std::map<std::string, int, std::less<>> pattern_ids;
+    for (const auto &entry : autopick_list) {
+        auto &rule = this->rules.emplace_back();
+        if (entry.name.starts_with('^')) {
+            rule.prefix = entry.name.substr(1);
+            continue;
+        }
+
+        auto it = pattern_ids.find(entry.name);
+        if (it == pattern_ids.end()) {
+            it = pattern_ids.emplace(entry.name, this->matcher.add(entry.name)).first;
+        }
+
+        rule.pattern_id = it->second;
+    }
+
+    this->matcher.build();
+    this->compiled_generation = this->generation;
+}
+
+const std::vector<int> &AutopickRuleIndex::get_bucket(ItemKindType tval)
+{
+    const auto it = this->buckets.find(tval);
+    if (it != this->buckets.end()) {
+        return it->second;
+    }
+
+    auto &bucket = this->buckets[tval];
+    for (auto i = 0U; i < autopick_list.size(); i++) {
+        if (is_autopick_kind_match(autopick_list[i], tval)) {
+            bucket.push_back(i);
+        }
+    }
+
+    return bucket;
+}
+
+AutopickRuleIndex::Result AutopickRuleIndex::evaluate(PlayerType *player_ptr, const ItemEntity &item)
+{
+    const auto tval = item.bi_key.tval();
+    if (tval == ItemKindType::GOLD) {
+        return { -1, true };
+    }
+
+    if (this->compiled_generation != this->generation) {
+        this->compile();
+    }
+
+    const auto &bucket = this->get_bucket(tval);
+    if (bucket.empty()) {
+        return { -1, true };
+    }
+
+    const auto item_name = str_tolower(describe_flavor(player_ptr, item, (OD_NO_FLAVOR | OD_OMIT_PREFIX | OD_NO_PLURAL)));
+    const auto matched = this->matcher.find_all(item_name);
+    auto is_cacheable = true;
+    for (const auto i : bucket) {
+        const auto &rule = this->rules[i];
+        const auto is_name_matched = rule.pattern_id ? matched[*rule.pattern_id] : item_name.starts_with(rule.prefix);
+        if (!is_name_matched) {
+            continue;
+        }
+
+        const auto &entry = autopick_list[i];
+        if (entry.has(FLG_COLLECTING)) {
+            is_cacheable = false;
+        }
+
+        if (is_autopick_match_except_name(player_ptr, &item, entry)) {
+            return { i, is_cacheable };
+        }
+    }
+
+    return { -1, is_cacheable };
+}
+
+AutopickRuleIndex::ItemState AutopickRuleIndex::get_item_state(const ItemEntity &item)
+{
+    return {
+        item.bi_key,
+        item.is_aware(),
+        item.ident,
+        item.feeling,
+        static_cast<int>(item.fa_id),
+        static_cast<int>(item.ego_idx),
+        item.pval,
+        item.to_h,
+        item.to_d,
+        item.to_a,
+        item.ac,
+        item.damage_dice,
+        item.randart_name,
+        item.art_flags,
+        item.curse_flags,
+        item.inscription,
+    };
+}
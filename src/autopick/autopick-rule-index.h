@@ -0,0 +1,98 @@
+#pragma once
+
+/*!
+ * @file autopick-rule-index.h
+ * @brief 自動拾いのエントリを検索用に前処理した索引
+ */
+
+#include "object-enchant/tr-flags.h"
+#include "object-enchant/trc-types.h"
+#include "system/baseitem/baseitem-key.h"
+#include "util/dice.h"
+#include "util/flag-group.h"
+#include "util/multi-pattern-matcher.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tl/optional.hpp>
+#include <unordered_map>
+#include <vector>
+
+class ItemEntity;
+class PlayerType;
+
+/*!
+ * @brief 自動拾いのエントリの索引
+ * @details アイテムの種別 (tval) ごとに種別指定の合うエントリだけを並べ、名前の部分一致は全エントリ分を
+ * Aho-Corasick法で1回の走査で調べる. 結果は先頭から順に調べた場合と同じく、最初に一致したエントリとなる.
+ * autopick_list を変更したら invalidate() を呼ぶこと.
+ */
+class AutopickRuleIndex {
+public:
+    AutopickRuleIndex(const AutopickRuleIndex &) = delete;
+    AutopickRuleIndex(AutopickRuleIndex &&) = delete;
+    AutopickRuleIndex &operator=(const AutopickRuleIndex &) = delete;
+    AutopickRuleIndex &operator=(AutopickRuleIndex &&) = delete;
+    static AutopickRuleIndex &get_instance();
+
+    void invalidate();
+    int find(PlayerType *player_ptr, const ItemEntity &item);
+    int find_cached(PlayerType *player_ptr, const ItemEntity &item);
+
+private:
+    AutopickRuleIndex() = default;
+
+    /*!
+     * @brief エントリの名前の一致条件
+     */
+    struct Rule {
+        tl::optional<int> pattern_id; //!< 部分一致のパターン番号. 前方一致ならばnullopt
+        std::string prefix; //!< 前方一致させる文字列
+    };
+
+    /*!
+     * @brief 検索結果の使い回しに用いるアイテムの状態
+     * @details 鑑定状態と、名前やエントリの条件 (ダイス目・呪い等) に表れる値.
+     */
+    struct ItemState {
+        BaseitemKey bi_key;
+        bool is_aware;
+        uint8_t ident;
+        uint8_t feeling;
+        int fa_id;
+        int ego_idx;
+        int pval;
+        int to_h;
+        int to_d;
+        int to_a;
+        int ac;
+        Dice damage_dice;
+        tl::optional<std::string> randart_name;
+        TrFlags art_flags;
+        EnumClassFlagGroup<CurseTraitType> curse_flags;
+        tl::optional<std::string> inscription;
+
+        bool operator==(const ItemState &other) const = default;
+    };
+
+    /*!
+     * @brief 検索結果
+     */
+    struct Result {
+        int index; //!< 一致したエントリの番号. なければ-1
+        bool is_cacheable; //!< 使い回してよいか (ザックの中身に依存するエントリを調べていないか)
+    };
+
+    uint32_t generation = 0; //!< autopick_list の変更回数
+    uint32_t compiled_generation = UINT32_MAX; //!< 索引を構築した時の変更回数
+    std::vector<Rule> rules;
+    MultiPatternMatcher matcher;
+    std::map<ItemKindType, std::vector<int>> buckets; //!< tvalごとの、種別指定の合うエントリ番号の昇順の並び. 最初に調べた時に作る
+    int64_t cached_turn = -1;
+    std::unordered_map<const ItemEntity *, std::pair<ItemState, int>> cache;
+
+    void compile();
+    const std::vector<int> &get_bucket(ItemKindType tval);
+    Result evaluate(PlayerType *player_ptr, const ItemEntity &item);
+    static ItemState get_item_state(const ItemEntity &item);
+};
@@ -27,6 +27,7 @@
 #include "dungeon/dungeon-processor.h"
 #include "dungeon/quest.h"
 #include "floor/floor-changer.h"
+#include "floor/floor-generation-benchmark.h"
 #include "floor/floor-leaver.h"
 #include "floor/floor-mode-changer.h"
 #include "floor/floor-save.h"
@@ -451,6 +452,10 @@ void play_game(PlayerType *player_ptr, bool new_game, bool browsing_movie)
     (void)combine_and_reorder_home(player_ptr, StoreSaleType::HOME);
     (void)combine_and_reorder_home(player_ptr, StoreSaleType::MUSEUM);
     select_floor_music(player_ptr);
+    if (auto &benchmark = FloorGenerationBenchmark::get_instance(); benchmark.is_enabled()) {
+        benchmark.run(player_ptr);
+    }
+
     process_game_turn(player_ptr);
     close_game(player_ptr);
     quit("");
@@ -50,6 +50,7 @@
 #include "term/screen-processor.h"
 #include "timed-effect/timed-effects.h"
 #include "tracking/health-bar-tracker.h"
+#include "util/trace.h"
 #include "view/display-messages.h"
 #include "world/world-turn-processor.h"
 
@@ -98,6 +99,7 @@ bool continuous_action_running(PlayerType *player_ptr)
  */
 void process_player(PlayerType *player_ptr)
 {
+    TRACE_SCOPE("process_player");
     if (player_ptr->hack_mutation) {
         msg_print(_("何か変わった気がする！", "You feel different!"));
         (void)gain_mutation(player_ptr, 0);
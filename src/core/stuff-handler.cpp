@@ -7,12 +7,14 @@
 #include "system/redrawing-flags-updater.h"
 #include "tracking/baseitem-tracker.h"
 #include "tracking/health-bar-tracker.h"
+#include "util/trace.h"
 
 /*!
  * @brief 全更新処理をチェックして処理していく
  */
 void handle_stuff(PlayerType *player_ptr)
 {
+    TRACE_SCOPE("handle_stuff");
     auto &rfu = RedrawingFlagsUpdater::get_instance();
     if (rfu.any_stats()) {
         update_creature(player_ptr);
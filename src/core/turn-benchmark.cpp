@@ -0,0 +1,133 @@
+/*!
+ * @file turn-benchmark.cpp
+ * @brief ゲームターン処理のベンチマーク実装
+ */
+
+#include "core/turn-benchmark.h"
+#include "game-option/special-options.h"
+#include "system/angband-system.h"
+#include "system/floor/floor-info.h"
+#include "system/player-type-definition.h"
+#include "term/z-util.h"
+#include <cstdio>
+#include <sstream>
+
+namespace {
+constexpr std::array<const char *, static_cast<size_t>(TurnBenchmarkPhase::MAX)> PHASE_NAMES = { {
+    "player",
+    "monsters",
+    "world",
+    "redraw",
+} };
+}
+
+TurnBenchmark &TurnBenchmark::get_instance()
+{
+    static TurnBenchmark instance;
+    return instance;
+}
+
+/*!
+ * @brief ベンチマークの設定を行う
+ * @param turns 計測するゲームターン数
+ * @param seed 計測開始時に設定する乱数のシード. nulloptならばセーブファイルの乱数状態をそのまま使う
+ */
+void TurnBenchmark::configure(int turns, tl::optional<uint32_t> seed)
+{
+    this->turns = turns;
+    this->seed = seed;
+}
+
+bool TurnBenchmark::is_enabled() const
+{
+    return this->turns > 0;
+}
+
+bool TurnBenchmark::is_running() const
+{
+    return this->running;
+}
+
+/*!
+ * @brief 計測を開始する
+ * @details process_dungeon() のループに入る直前に呼ぶ. 階を移動して再び呼ばれた場合は計測を継続する.
+ * 計測中にセーブファイルが書き換わらないよう、自動セーブは無効にする.
+ */
+void TurnBenchmark::start()
+{
+    if (!this->is_enabled() || this->running) {
+        return;
+    }
+
+    if (this->seed) {
+        AngbandSystem::get_instance().get_rng().set_state(*this->seed);
+    }
+
+    autosave_t = false;
+    autosave_l = false;
+    this->running = true;
+    this->elapsed_turns = 0;
+    this->phase_times.fill({});
+    this->start_time = std::chrono::steady_clock::now();
+}
+
+/*!
+ * @brief 1ゲームターンの処理が終わったことを通知する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @details 指定したゲームターン数に達したら結果を表示してゲームを終了する.
+ */
+void TurnBenchmark::finish_turn(PlayerType *player_ptr)
+{
+    if (!this->running) {
+        return;
+    }
+
+    this->elapsed_turns++;
+    if (this->elapsed_turns >= this->turns) {
+        this->finish(player_ptr);
+    }
+}
+
+/*!
+ * @brief 計測を終了し、結果を表示してゲームを終了する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @details プレイヤーが死亡した場合など、指定したゲームターン数に達する前に呼ばれることもある.
+ */
+void TurnBenchmark::finish(PlayerType *player_ptr)
+{
+    if (!this->running) {
+        return;
+    }
+
+    this->running = false;
+    const auto report = this->create_report(player_ptr);
+    fputs(report.data(), stdout);
+    quit("");
+}
+
+std::string TurnBenchmark::create_report(PlayerType *player_ptr) const
+{
+    using seconds = std::chrono::duration<double>;
+    const auto elapsed = seconds(std::chrono::steady_clock::now() - this->start_time).count();
+    std::stringstream ss;
+    ss << "turns: " << this->elapsed_turns << '/' << this->turns;
+    if (player_ptr->is_dead) {
+        ss << " (player died)";
+    }
+
+    ss << '\n';
+    ss << "elapsed: " << elapsed << " s\n";
+    ss << "turns/sec: " << ((elapsed > 0.0) ? (this->elapsed_turns / elapsed) : 0.0) << '\n';
+    for (size_t i = 0; i < PHASE_NAMES.size(); i++) {
+        const auto phase_sec = seconds(this->phase_times[i]).count();
+        const auto ratio = (elapsed > 0.0) ? (100.0 * phase_sec / elapsed) : 0.0;
+        ss << PHASE_NAMES[i] << ": " << (phase_sec * 1000.0) << " ms (" << ratio << "%)\n";
+    }
+
+    // 同じ入力から同じ結果になったかを確認するための値
+    const auto &floor = *player_ptr->current_floor_ptr;
+    const auto &state = AngbandSystem::get_instance().get_rng().get_state();
+    ss << "final: depth " << floor.dun_level << ", pos (" << player_ptr->y << ", " << player_ptr->x << "), hp " << player_ptr->chp;
+    ss << ", monsters " << floor.m_cnt << ", rng " << std::hex << state[0] << state[1] << state[2] << state[3] << std::dec << '\n';
+    return ss.str();
+}
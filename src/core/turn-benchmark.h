@@ -0,0 +1,76 @@
+#pragma once
+
+/*!
+ * @file turn-benchmark.h
+ * @brief ゲームターン処理のベンチマーク定義
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <tl/optional.hpp>
+
+/*!
+ * @brief ベンチマークで計測するゲームターン処理の区分
+ */
+enum class TurnBenchmarkPhase {
+    PLAYER, //!< プレイヤーの行動 (process_player / process_upkeep_with_speed)
+    MONSTERS, //!< モンスターの行動 (process_monsters)
+    WORLD, //!< 世界の時間経過 (WorldTurnProcessor::process_world)
+    REDRAW, //!< 各処理の後の再計算と再描画 (handle_stuff / term_fresh)
+    MAX,
+};
+
+class PlayerType;
+
+/*!
+ * @brief ゲームターン処理のベンチマーク
+ * @details 指定したゲームターン数だけ process_dungeon() のループを回し、1秒あたりのゲームターン数と区分ごとの処理時間を標準出力に表示して終了する.
+ * 入力はヘッドレス表示モジュール (main-headless.cpp) が与えるキー列で行い、ゲームのセーブは行わない.
+ */
+class TurnBenchmark {
+public:
+    TurnBenchmark(const TurnBenchmark &) = delete;
+    TurnBenchmark(TurnBenchmark &&) = delete;
+    TurnBenchmark &operator=(const TurnBenchmark &) = delete;
+    TurnBenchmark &operator=(TurnBenchmark &&) = delete;
+    static TurnBenchmark &get_instance();
+
+    void configure(int turns, tl::optional<uint32_t> seed);
+    bool is_enabled() const;
+    bool is_running() const;
+    void start();
+    void finish_turn(PlayerType *player_ptr);
+    void finish(PlayerType *player_ptr);
+
+    /*!
+     * @brief 処理を実行し、ベンチマーク中であれば所要時間を区分ごとに積算する
+     * @param phase 処理の区分
+     * @param process 実行する処理
+     */
+    template <typename F>
+    void measure(TurnBenchmarkPhase phase, F process)
+    {
+        if (!this->running) {
+            process();
+            return;
+        }
+
+        const auto start_time = std::chrono::steady_clock::now();
+        process();
+        this->phase_times[static_cast<size_t>(phase)] += std::chrono::steady_clock::now() - start_time;
+    }
+
+private:
+    TurnBenchmark() = default;
+
+    int turns = 0; //!< 計測するゲームターン数. 0ならばベンチマークを行わない
+    tl::optional<uint32_t> seed; //!< 計測開始時に設定する乱数のシード
+    bool running = false;
+    int elapsed_turns = 0;
+    std::chrono::steady_clock::time_point start_time;
+    std::array<std::chrono::steady_clock::duration, static_cast<size_t>(TurnBenchmarkPhase::MAX)> phase_times{};
+
+    std::string create_report(PlayerType *player_ptr) const;
+};
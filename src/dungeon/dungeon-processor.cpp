@@ -4,6 +4,7 @@
 #include "core/object-compressor.h"
 #include "core/player-processor.h"
 #include "core/stuff-handler.h"
+#include "core/turn-benchmark.h"
 #include "core/turn-compensator.h"
 #include "dungeon/quest.h"
 #include "floor/floor-leaver.h"
@@ -30,6 +31,7 @@
 #include "system/monrace/monrace-definition.h"
 #include "system/redrawing-flags-updater.h"
 #include "target/target-checker.h"
+#include "util/trace.h"
 #include "view/display-messages.h"
 #include "world/world-turn-processor.h"
 #include "world/world.h"
@@ -75,6 +77,19 @@ static void redraw_character_xtra(PlayerType *player_ptr)
     world.character_xtra = false;
 }
 
+/*!
+ * @brief ゲームターン中の各処理の後に再計算と再描画を行う
+ * @param player_ptr プレイヤーへの参照ポインタ
+ */
+static void redraw_after_turn_phase(PlayerType *player_ptr)
+{
+    handle_stuff(player_ptr);
+    move_cursor_relative(player_ptr->y, player_ptr->x);
+    if (fresh_after) {
+        term_fresh_force();
+    }
+}
+
 /*!
  * process_player()、process_world() をcore.c から移設するのが先.
  * process_upkeep_with_speed() はこの関数と同じところでOK
@@ -205,7 +220,10 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
     floor.leave_dungeon(false);
     floor.reset_mproc();
 
+    auto &benchmark = TurnBenchmark::get_instance();
+    benchmark.start();
     while (true) {
+        TRACE_SCOPE("game turn");
         if ((floor.m_cnt + 32 > MAX_FLOOR_MONSTERS) && !is_watching) {
             compact_monsters(player_ptr, 64);
         }
@@ -218,39 +236,23 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
             compact_objects(player_ptr, 64);
         }
 
-        process_player(player_ptr);
-        process_upkeep_with_speed(player_ptr);
-        handle_stuff(player_ptr);
-
-        move_cursor_relative(player_ptr->y, player_ptr->x);
-        if (fresh_after) {
-            term_fresh_force();
-        }
-
+        benchmark.measure(TurnBenchmarkPhase::PLAYER, [player_ptr] {
+            process_player(player_ptr);
+            process_upkeep_with_speed(player_ptr);
+        });
+        benchmark.measure(TurnBenchmarkPhase::REDRAW, [player_ptr] { redraw_after_turn_phase(player_ptr); });
         if (!player_ptr->playing || player_ptr->is_dead) {
             break;
         }
 
-        process_monsters(player_ptr);
-        handle_stuff(player_ptr);
-
-        move_cursor_relative(player_ptr->y, player_ptr->x);
-        if (fresh_after) {
-            term_fresh_force();
-        }
-
+        benchmark.measure(TurnBenchmarkPhase::MONSTERS, [player_ptr] { process_monsters(player_ptr); });
+        benchmark.measure(TurnBenchmarkPhase::REDRAW, [player_ptr] { redraw_after_turn_phase(player_ptr); });
         if (!player_ptr->playing || player_ptr->is_dead) {
             break;
         }
 
-        WorldTurnProcessor(player_ptr).process_world();
-        handle_stuff(player_ptr);
-
-        move_cursor_relative(player_ptr->y, player_ptr->x);
-        if (fresh_after) {
-            term_fresh_force();
-        }
-
+        benchmark.measure(TurnBenchmarkPhase::WORLD, [player_ptr] { WorldTurnProcessor(player_ptr).process_world(); });
+        benchmark.measure(TurnBenchmarkPhase::REDRAW, [player_ptr] { redraw_after_turn_phase(player_ptr); });
         if (!player_ptr->playing || player_ptr->is_dead) {
             break;
         }
@@ -266,6 +268,7 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
         }
 
         prevent_turn_overflow(player_ptr);
+        benchmark.finish_turn(player_ptr);
 
         if (player_ptr->leaving) {
             break;
@@ -276,6 +279,10 @@ void process_dungeon(PlayerType *player_ptr, bool load_game)
         }
     }
 
+    if (!player_ptr->playing || player_ptr->is_dead) {
+        benchmark.finish(player_ptr);
+    }
+
     if ((inside_quest(quest_id)) && monrace_questor.kind_flags.has_not(MonsterKindType::UNIQUE)) {
         monrace_questor.misc_flags.reset(MonsterMiscType::QUESTOR);
     }
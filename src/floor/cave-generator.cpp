@@ -3,6 +3,7 @@
 #include "dungeon/quest-monster-placer.h"
 #include "floor/dungeon-tunnel-util.h"
 #include "floor/floor-allocation-types.h"
+#include "floor/floor-generation-benchmark.h"
 #include "floor/floor-streams.h"
 #include "floor/geometry.h"
 #include "floor/object-allocator.h"
@@ -165,20 +166,26 @@ static bool make_one_floor(PlayerType *player_ptr, DungeonData *dd_ptr, const Du
     if (floor.get_dungeon_definition().flags.has(DungeonFeatureType::NO_ROOM)) {
         make_only_tunnel_points(floor, dd_ptr);
     } else {
+        FloorGenerationStageTimer timer(FloorGenerationStage::ROOMS);
         if (!generate_rooms(player_ptr, dd_ptr)) {
             dd_ptr->why = _("部屋群の生成に失敗", "Failed to generate rooms");
             return false;
         }
     }
 
-    place_cave_contents(player_ptr, dd_ptr, dungeon);
-    dt_type tmp_dt;
-    dt_type *dt_ptr = initialize_dt_type(&tmp_dt);
-    if (!make_centers(player_ptr, dd_ptr, dungeon, dt_ptr)) {
-        return false;
+    {
+        FloorGenerationStageTimer timer(FloorGenerationStage::TUNNELS);
+        place_cave_contents(player_ptr, dd_ptr, dungeon);
+        dt_type tmp_dt;
+        dt_type *dt_ptr = initialize_dt_type(&tmp_dt);
+        if (!make_centers(player_ptr, dd_ptr, dungeon, dt_ptr)) {
+            return false;
+        }
+
+        make_doors(player_ptr, dd_ptr, dt_ptr);
     }
 
-    make_doors(player_ptr, dd_ptr, dt_ptr);
+    FloorGenerationStageTimer timer(FloorGenerationStage::STAIRS);
     const auto &terrains = TerrainList::get_instance();
     if (!alloc_stairs(player_ptr, terrains.get_terrain_id(TerrainTag::DOWN_STAIR), rand_range(3, 4), 3)) {
         dd_ptr->why = _("下り階段生成に失敗", "Failed to generate down stairs.");
@@ -197,7 +204,12 @@ static bool switch_making_floor(PlayerType *player_ptr, DungeonData *dd_ptr, con
 {
     if (dungeon.flags.has(DungeonFeatureType::MAZE)) {
         const auto &floor = *player_ptr->current_floor_ptr;
-        build_maze_vault(player_ptr, { floor.height / 2 - 1, floor.width / 2 - 1 }, { floor.height - 4, floor.width - 4 }, false);
+        {
+            FloorGenerationStageTimer timer(FloorGenerationStage::ROOMS);
+            build_maze_vault(player_ptr, { floor.height / 2 - 1, floor.width / 2 - 1 }, { floor.height - 4, floor.width - 4 }, false);
+        }
+
+        FloorGenerationStageTimer timer(FloorGenerationStage::STAIRS);
         const auto &terrains = TerrainList::get_instance();
         if (!alloc_stairs(player_ptr, terrains.get_terrain_id(TerrainTag::DOWN_STAIR), rand_range(2, 3), 3)) {
             dd_ptr->why = _("迷宮ダンジョンの下り階段生成に失敗", "Failed to alloc up stairs in maze dungeon.");
@@ -273,6 +285,7 @@ static void make_perm_walls(PlayerType *player_ptr)
 
 static bool check_place_necessary_objects(PlayerType *player_ptr, DungeonData *dd_ptr)
 {
+    FloorGenerationStageTimer timer(FloorGenerationStage::PLACEMENT);
     const auto p_pos = new_player_spot(player_ptr);
     if (!p_pos) {
         dd_ptr->why = _("プレイヤー配置に失敗", "Failed to place a player");
@@ -320,27 +333,35 @@ static void decide_dungeon_data_allocation(PlayerType *player_ptr, DungeonData *
 static bool allocate_dungeon_data(PlayerType *player_ptr, DungeonData *dd_ptr, const DungeonDefinition &dungeon)
 {
     dd_ptr->alloc_monster_num += randint1(8);
-    for (dd_ptr->alloc_monster_num = dd_ptr->alloc_monster_num + dd_ptr->alloc_object_num; dd_ptr->alloc_monster_num > 0; dd_ptr->alloc_monster_num--) {
-        (void)alloc_monster(player_ptr, 0, PM_ALLOW_SLEEP, summon_specific);
+    {
+        FloorGenerationStageTimer timer(FloorGenerationStage::MONSTERS);
+        for (dd_ptr->alloc_monster_num = dd_ptr->alloc_monster_num + dd_ptr->alloc_object_num; dd_ptr->alloc_monster_num > 0; dd_ptr->alloc_monster_num--) {
+            (void)alloc_monster(player_ptr, 0, PM_ALLOW_SLEEP, summon_specific);
+        }
     }
 
-    alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_TRAP, randint1(dd_ptr->alloc_object_num));
-    if (dungeon.flags.has_not(DungeonFeatureType::NO_CAVE)) {
-        alloc_object(player_ptr, ALLOC_SET_CORR, ALLOC_TYP_RUBBLE, randint1(dd_ptr->alloc_object_num));
-    }
+    {
+        FloorGenerationStageTimer timer(FloorGenerationStage::OBJECTS);
+        alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_TRAP, randint1(dd_ptr->alloc_object_num));
+        if (dungeon.flags.has_not(DungeonFeatureType::NO_CAVE)) {
+            alloc_object(player_ptr, ALLOC_SET_CORR, ALLOC_TYP_RUBBLE, randint1(dd_ptr->alloc_object_num));
+        }
 
-    auto &floor = *player_ptr->current_floor_ptr;
-    if (floor.is_entering_dungeon() && floor.dun_level > 1) {
-        floor.object_level = 1;
+        auto &floor = *player_ptr->current_floor_ptr;
+        if (floor.is_entering_dungeon() && floor.dun_level > 1) {
+            floor.object_level = 1;
+        }
+
+        constexpr auto alloc_room = 9;
+        alloc_object(player_ptr, ALLOC_SET_ROOM, ALLOC_TYP_OBJECT, randnor(alloc_room, 3));
+        constexpr auto alloc_item = 3;
+        alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_OBJECT, randnor(alloc_item, 3));
+        constexpr auto alloc_gold = 3;
+        alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_GOLD, randnor(alloc_gold, 3));
+        floor.object_level = floor.base_level;
     }
 
-    constexpr auto alloc_room = 9;
-    alloc_object(player_ptr, ALLOC_SET_ROOM, ALLOC_TYP_OBJECT, randnor(alloc_room, 3));
-    constexpr auto alloc_item = 3;
-    alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_OBJECT, randnor(alloc_item, 3));
-    constexpr auto alloc_gold = 3;
-    alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_GOLD, randnor(alloc_gold, 3));
-    floor.object_level = floor.base_level;
+    FloorGenerationStageTimer timer(FloorGenerationStage::MONSTERS);
     if (alloc_guardian(player_ptr, true)) {
         return true;
     }
@@ -383,14 +404,22 @@ tl::optional<std::string> cave_gen(PlayerType *player_ptr)
         msg_print_wizard(player_ptr, CHEAT_DUNGEON, _("アリーナレベルを生成。", "Arena level."));
     }
 
-    check_arena_floor(player_ptr, &dd);
-    gen_caverns_and_lakes(player_ptr, dungeon, &dd);
+    {
+        FloorGenerationStageTimer timer(FloorGenerationStage::LAYOUT);
+        check_arena_floor(player_ptr, &dd);
+        gen_caverns_and_lakes(player_ptr, dungeon, &dd);
+    }
+
     if (!switch_making_floor(player_ptr, &dd, dungeon)) {
         return dd.why;
     }
 
-    make_aqua_streams(player_ptr, &dd, dungeon);
-    make_perm_walls(player_ptr);
+    {
+        FloorGenerationStageTimer timer(FloorGenerationStage::STREAMERS);
+        make_aqua_streams(player_ptr, &dd, dungeon);
+        make_perm_walls(player_ptr);
+    }
+
     if (!check_place_necessary_objects(player_ptr, &dd)) {
         return dd.why;
     }
@@ -0,0 +1,259 @@
+/*!
+ * @file floor-generation-benchmark.cpp
+ * @brief フロア生成のベンチマーク実装
+ */
+
+#include "floor/floor-generation-benchmark.h"
+#include "dungeon/quest.h"
+#include "floor/floor-generator.h"
+#include "floor/floor-util.h"
+#include "monster-floor/monster-remover.h"
+#include "system/angband-system.h"
+#include "system/dungeon/dungeon-definition.h"
+#include "system/dungeon/dungeon-list.h"
+#include "system/enums/dungeon/dungeon-id.h"
+#include "system/floor/floor-info.h"
+#include "system/player-type-definition.h"
+#include "term/z-util.h"
+#include "world/world.h"
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+namespace {
+constexpr std::array<const char *, static_cast<size_t>(FloorGenerationStage::MAX)> STAGE_NAMES = { {
+    "layout",
+    "rooms",
+    "vaults",
+    "tunnels",
+    "stairs",
+    "streamers",
+    "placement",
+    "monsters",
+    "objects",
+    "connectivity",
+} };
+
+constexpr size_t SLOWEST_LEVELS_NUM = 10; //!< 報告する生成の遅い階の数
+
+double to_ms(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+}
+
+FloorGenerationBenchmark &FloorGenerationBenchmark::get_instance()
+{
+    static FloorGenerationBenchmark instance;
+    return instance;
+}
+
+/*!
+ * @brief ベンチマークの設定を行う
+ * @param floors 1つの階で生成するフロアの数
+ * @param seed 計測開始時に設定する乱数のシード. nulloptならばセーブファイルの乱数状態をそのまま使う
+ */
+void FloorGenerationBenchmark::configure(int floors, tl::optional<uint32_t> seed)
+{
+    this->floors = floors;
+    this->seed = seed;
+}
+
+bool FloorGenerationBenchmark::is_enabled() const
+{
+    return this->floors > 0;
+}
+
+bool FloorGenerationBenchmark::is_running() const
+{
+    return this->running;
+}
+
+/*!
+ * @brief 全てのダンジョンの全ての階でフロアを生成し、結果を表示してゲームを終了する
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @details クエスト階や地上は対象外とする. 生成したフロアのモンスターとアイテムは毎回消去する.
+ */
+void FloorGenerationBenchmark::run(PlayerType *player_ptr)
+{
+    if (this->seed) {
+        AngbandSystem::get_instance().get_rng().set_state(*this->seed);
+    }
+
+    auto &floor = *player_ptr->current_floor_ptr;
+    auto &world = AngbandWorld::get_instance();
+    world.character_dungeon = false; // 消去したアイテムの固定アーティファクトを未生成に戻すため
+    floor.quest_number = QuestId::NONE;
+    floor.inside_arena = false;
+    this->running = true;
+    this->stage_times.fill({});
+    this->retry_reasons.clear();
+    this->level_records.clear();
+    const auto start_time = std::chrono::steady_clock::now();
+    for (const auto &[dungeon_id, dungeon] : DungeonList::get_instance()) {
+        if (dungeon_id == DungeonId::WILDERNESS) {
+            continue;
+        }
+
+        for (auto depth = std::max<int>(dungeon->mindepth, 1); depth <= dungeon->maxdepth; depth++) {
+            auto &record = this->level_records.emplace_back(LevelRecord{ dungeon_id, depth });
+            for (auto i = 0; i < this->floors; i++) {
+                floor.set_dungeon_index(dungeon_id);
+                floor.dun_level = depth;
+                const auto floor_start_time = std::chrono::steady_clock::now();
+                generate_floor(player_ptr);
+                const auto floor_time = std::chrono::steady_clock::now() - floor_start_time;
+                record.floors++;
+                record.total += floor_time;
+                record.max = std::max(record.max, floor_time);
+                wipe_o_list(floor);
+                wipe_monsters_list(player_ptr);
+            }
+        }
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+    this->running = false;
+    const auto report = this->create_report(elapsed);
+    fputs(report.data(), stdout);
+    quit("");
+}
+
+/*!
+ * @brief 計測する段階を切り替える
+ * @param stage 新たに計測する段階
+ * @return 切り替える前に計測していた段階
+ */
+tl::optional<FloorGenerationStage> FloorGenerationBenchmark::enter_stage(FloorGenerationStage stage)
+{
+    this->add_stage_time();
+    const auto previous_stage = this->current_stage;
+    this->current_stage = stage;
+    return previous_stage;
+}
+
+/*!
+ * @brief 計測していた段階を終え、切り替える前の段階に戻す
+ * @param previous_stage enter_stage() が返した段階
+ */
+void FloorGenerationBenchmark::leave_stage(tl::optional<FloorGenerationStage> previous_stage)
+{
+    this->add_stage_time();
+    this->current_stage = previous_stage;
+}
+
+/*!
+ * @brief フロア生成のやり直しを記録する
+ * @param reason やり直しの理由
+ */
+void FloorGenerationBenchmark::count_retry(std::string_view reason)
+{
+    if (!this->running) {
+        return;
+    }
+
+    auto it = this->retry_reasons.find(reason);
+    if (it == this->retry_reasons.end()) {
+        it = this->retry_reasons.emplace(reason, 0).first;
+    }
+
+    it->second++;
+    if (!this->level_records.empty()) {
+        this->level_records.back().retries++;
+    }
+}
+
+void FloorGenerationBenchmark::add_stage_time()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (this->current_stage) {
+        this->stage_times[static_cast<size_t>(*this->current_stage)] += now - this->stage_start_time;
+    }
+
+    this->stage_start_time = now;
+}
+
+std::string FloorGenerationBenchmark::create_report(std::chrono::steady_clock::duration elapsed) const
+{
+    const auto elapsed_ms = to_ms(elapsed);
+    auto total_floors = 0;
+    auto total_retries = 0;
+    for (const auto &record : this->level_records) {
+        total_floors += record.floors;
+        total_retries += record.retries;
+    }
+
+    std::stringstream ss;
+    ss << "floors: " << total_floors << " (" << this->floors << " per level, " << this->level_records.size() << " levels)\n";
+    ss << "elapsed: " << (elapsed_ms / 1000.0) << " s\n";
+    ss << "floors/sec: " << ((elapsed_ms > 0.0) ? (1000.0 * total_floors / elapsed_ms) : 0.0) << '\n';
+    auto other_ms = elapsed_ms;
+    for (size_t i = 0; i < STAGE_NAMES.size(); i++) {
+        const auto stage_ms = to_ms(this->stage_times[i]);
+        other_ms -= stage_ms;
+        ss << STAGE_NAMES[i] << ": " << stage_ms << " ms (" << ((elapsed_ms > 0.0) ? (100.0 * stage_ms / elapsed_ms) : 0.0) << "%)\n";
+    }
+
+    ss << "other: " << other_ms << " ms (" << ((elapsed_ms > 0.0) ? (100.0 * other_ms / elapsed_ms) : 0.0) << "%)\n";
+    ss << "retries: " << total_retries << '\n';
+    for (const auto &[reason, count] : this->retry_reasons) {
+        ss << "  " << reason << ": " << count << '\n';
+    }
+
+    const auto &dungeons = DungeonList::get_instance();
+    ss << "dungeons:\n";
+    for (auto it = this->level_records.begin(); it != this->level_records.end();) {
+        const auto dungeon_id = it->dungeon_id;
+        auto floors = 0;
+        auto retries = 0;
+        std::chrono::steady_clock::duration total{};
+        const LevelRecord *slowest = nullptr;
+        for (; (it != this->level_records.end()) && (it->dungeon_id == dungeon_id); ++it) {
+            floors += it->floors;
+            retries += it->retries;
+            total += it->total;
+            if ((slowest == nullptr) || (it->max > slowest->max)) {
+                slowest = &*it;
+            }
+        }
+
+        ss << "  " << dungeons.get_dungeon(dungeon_id).name << ": " << floors << " floors, mean " << ((floors > 0) ? (to_ms(total) / floors) : 0.0);
+        ss << " ms, max " << to_ms(slowest->max) << " ms (depth " << slowest->depth << "), retries " << retries << '\n';
+    }
+
+    std::vector<const LevelRecord *> slowest_levels;
+    for (const auto &record : this->level_records) {
+        slowest_levels.push_back(&record);
+    }
+
+    const auto mean_ms = [](const LevelRecord *record) { return (record->floors > 0) ? (to_ms(record->total) / record->floors) : 0.0; };
+    const auto num = std::min(SLOWEST_LEVELS_NUM, slowest_levels.size());
+    std::partial_sort(slowest_levels.begin(), slowest_levels.begin() + num, slowest_levels.end(),
+        [&mean_ms](const auto *a, const auto *b) { return mean_ms(a) > mean_ms(b); });
+    ss << "slowest levels:\n";
+    for (size_t i = 0; i < num; i++) {
+        const auto *record = slowest_levels[i];
+        ss << "  " << dungeons.get_dungeon(record->dungeon_id).name << " depth " << record->depth << ": mean " << mean_ms(record);
+        ss << " ms, max " << to_ms(record->max) << " ms, retries " << record->retries << '\n';
+    }
+
+    // 同じシードから同じフロア群が生成されたかを確認するための値
+    const auto &state = AngbandSystem::get_instance().get_rng().get_state();
+    ss << "final: rng " << std::hex << state[0] << state[1] << state[2] << state[3] << std::dec << '\n';
+    return ss.str();
+}
+
+FloorGenerationStageTimer::FloorGenerationStageTimer(FloorGenerationStage stage)
+    : is_active(FloorGenerationBenchmark::get_instance().is_running())
+{
+    if (this->is_active) {
+        this->previous_stage = FloorGenerationBenchmark::get_instance().enter_stage(stage);
+    }
+}
+
+FloorGenerationStageTimer::~FloorGenerationStageTimer()
+{
+    if (this->is_active) {
+        FloorGenerationBenchmark::get_instance().leave_stage(this->previous_stage);
+    }
+}
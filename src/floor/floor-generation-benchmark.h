@@ -0,0 +1,102 @@
+#pragma once
+
+/*!
+ * @file floor-generation-benchmark.h
+ * @brief フロア生成のベンチマーク定義
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tl/optional.hpp>
+#include <vector>
+
+/*!
+ * @brief ベンチマークで計測するフロア生成処理の段階
+ */
+enum class FloorGenerationStage {
+    LAYOUT, //!< 外枠・洞窟・湖 (check_arena_floor / gen_caverns_and_lakes)
+    ROOMS, //!< 部屋と迷宮 (Vaultを除く)
+    VAULTS, //!< Vault (小型・大型・ランダムVaultと固定部屋)
+    TUNNELS, //!< トンネルと扉
+    STAIRS, //!< 階段
+    STREAMERS, //!< 鉱脈と外周の永久壁
+    PLACEMENT, //!< プレイヤーとクエストモンスターの配置
+    MONSTERS, //!< モンスターの配置
+    OBJECTS, //!< アイテム・罠・瓦礫・財宝の配置
+    CONNECTIVITY, //!< 連結性の判定
+    MAX,
+};
+
+enum class DungeonId;
+class PlayerType;
+
+/*!
+ * @brief フロア生成のベンチマーク
+ * @details 全てのダンジョンの全ての階で、指定した数だけ generate_floor() を繰り返し、
+ * 段階ごとの処理時間と生成やり直しの回数を標準出力に表示して終了する. ゲームのセーブは行わない.
+ */
+class FloorGenerationBenchmark {
+public:
+    FloorGenerationBenchmark(const FloorGenerationBenchmark &) = delete;
+    FloorGenerationBenchmark(FloorGenerationBenchmark &&) = delete;
+    FloorGenerationBenchmark &operator=(const FloorGenerationBenchmark &) = delete;
+    FloorGenerationBenchmark &operator=(FloorGenerationBenchmark &&) = delete;
+    static FloorGenerationBenchmark &get_instance();
+
+    void configure(int floors, tl::optional<uint32_t> seed);
+    bool is_enabled() const;
+    bool is_running() const;
+    void run(PlayerType *player_ptr);
+    tl::optional<FloorGenerationStage> enter_stage(FloorGenerationStage stage);
+    void leave_stage(tl::optional<FloorGenerationStage> previous_stage);
+    void count_retry(std::string_view reason);
+
+private:
+    FloorGenerationBenchmark() = default;
+
+    /*!
+     * @brief 1つの階での計測結果
+     */
+    struct LevelRecord {
+        DungeonId dungeon_id;
+        int depth;
+        int floors = 0;
+        int retries = 0;
+        std::chrono::steady_clock::duration total{};
+        std::chrono::steady_clock::duration max{};
+    };
+
+    int floors = 0; //!< 1つの階で生成するフロアの数. 0ならばベンチマークを行わない
+    tl::optional<uint32_t> seed; //!< 計測開始時に設定する乱数のシード
+    bool running = false;
+    tl::optional<FloorGenerationStage> current_stage; //!< 計測中の段階
+    std::chrono::steady_clock::time_point stage_start_time;
+    std::array<std::chrono::steady_clock::duration, static_cast<size_t>(FloorGenerationStage::MAX)> stage_times{};
+    std::map<std::string, int, std::less<>> retry_reasons;
+    std::vector<LevelRecord> level_records;
+
+    void add_stage_time();
+    std::string create_report(std::chrono::steady_clock::duration elapsed) const;
+};
+
+/*!
+ * @brief スコープの間の処理時間をフロア生成ベンチマークの段階に積算する
+ * @details 入れ子にした場合は内側の段階の時間だけが内側に積算される. ベンチマーク中でなければ何もしない.
+ */
+class FloorGenerationStageTimer {
+public:
+    explicit FloorGenerationStageTimer(FloorGenerationStage stage);
+    ~FloorGenerationStageTimer();
+    FloorGenerationStageTimer(const FloorGenerationStageTimer &) = delete;
+    FloorGenerationStageTimer(FloorGenerationStageTimer &&) = delete;
+    FloorGenerationStageTimer &operator=(const FloorGenerationStageTimer &) = delete;
+    FloorGenerationStageTimer &operator=(FloorGenerationStageTimer &&) = delete;
+
+private:
+    bool is_active;
+    tl::optional<FloorGenerationStage> previous_stage;
+};
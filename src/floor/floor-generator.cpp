@@ -14,6 +14,7 @@
 #include "dungeon/quest.h"
 #include "floor/cave-generator.h"
 #include "floor/floor-events.h"
+#include "floor/floor-generation-benchmark.h"
 #include "floor/floor-save.h" //!< @todo precalc_cur_num_of_pet() が依存している、違和感.
 #include "floor/floor-util.h"
 #include "floor/wild.h"
@@ -395,12 +396,12 @@ void clear_cave(PlayerType *player_ptr)
             grid.m_idx = 0;
             grid.special = 0;
             grid.mimic = 0;
-            grid.reset_costs();
-            grid.reset_dists();
             grid.when = 0;
         }
     }
 
+    floor.get_flow_field().reset();
+
     floor.base_level = floor.dun_level;
     floor.monster_level = floor.base_level;
     floor.object_level = floor.base_level;
@@ -494,6 +495,13 @@ static bool floor_is_connected(const FloorType &floor, const IsWallFunc is_wall)
     return n_component == 1;
 }
 
+// 連結性の判定にかかった時間をフロア生成ベンチマークに積算する。
+static bool is_connected_floor(const FloorType &floor)
+{
+    FloorGenerationStageTimer timer(FloorGenerationStage::CONNECTIVITY);
+    return floor_is_connected(floor, is_permanent_blocker);
+}
+
 /*!
  * ダンジョンのランダムフロアを生成する / Generates a random dungeon level -RAK-
  * @parama player_ptr プレイヤーへの参照ポインタ
@@ -534,7 +542,7 @@ void generate_floor(PlayerType *player_ptr)
         // 地上、荒野マップ、クエストでは連結性判定は行わない。
         // TODO: 本来はダンジョン生成アルゴリズム自身で連結性を保証するのが理想ではある。
         const auto check_conn = why && floor.is_underground() && !floor.is_in_quest();
-        if (check_conn && !floor_is_connected(floor, is_permanent_blocker)) {
+        if (check_conn && !is_connected_floor(floor)) {
             // 一定回数試しても連結にならないなら諦める。
             if (num >= 1000) {
                 plog("cannot generate connected floor. giving up...");
@@ -547,6 +555,7 @@ void generate_floor(PlayerType *player_ptr)
             break;
         }
 
+        FloorGenerationBenchmark::get_instance().count_retry(*why);
         msg_format(_("生成やり直し(%s)", "Generation restarted (%s)"), why->data());
         wipe_o_list(floor);
         wipe_monsters_list(player_ptr);
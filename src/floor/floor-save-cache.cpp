@@ -0,0 +1,150 @@
+/*!
+ * @brief 保存フロアのメモリキャッシュ実装
+ */
+
+#include "floor/floor-save-cache.h"
+#include "io/uid-checker.h"
+#include "util/angband-files.h"
+#include <algorithm>
+
+SavedFloorCache SavedFloorCache::instance{};
+
+SavedFloorCache &SavedFloorCache::get_instance()
+{
+    return instance;
+}
+
+/*!
+ * @brief メモリ使用量の上限を設定する
+ * @param budget 上限 (バイト). 0ならば全て即座に一時ファイルへ書き出す.
+ * @details 次に store() した時から適用される. ゲーム開始前に呼ぶこと.
+ */
+void SavedFloorCache::set_memory_budget(size_t budget)
+{
+    this->memory_budget = budget;
+}
+
+/*!
+ * @brief 一時保存データをキャッシュに格納する
+ * @param savefile_id 保存フロアのファイルID
+ * @param path 書き出す時の一時ファイル名
+ * @param image 一時保存データ
+ * @return 一時ファイルへの書き出しに失敗して失われた保存フロアのファイルID (格納したもの自身を含むことがある)
+ * @details 同じIDのデータは置き換える. 上限を超えた場合は古いものから一時ファイルへ書き出す.
+ */
+std::vector<int> SavedFloorCache::store(int savefile_id, const std::filesystem::path &path, std::vector<byte> &&image)
+{
+    this->erase(savefile_id);
+    this->memory_usage += image.size();
+    this->entries.push_back({ savefile_id, path, std::move(image), this->use_counter++ });
+    return this->spill_over_budget();
+}
+
+/*!
+ * @brief キャッシュにある一時保存データを参照する
+ * @param savefile_id 保存フロアのファイルID
+ * @return 一時保存データへの参照. キャッシュに無ければnullopt
+ * @details 参照はキャッシュに次の変更 (store/take/erase/clear/set_memory_budget) が加わるまで有効.
+ */
+tl::optional<std::span<const byte>> SavedFloorCache::find(int savefile_id)
+{
+    const auto it = this->find_entry(savefile_id);
+    if (it == this->entries.end()) {
+        return tl::nullopt;
+    }
+
+    it->last_used = this->use_counter++;
+    return it->image;
+}
+
+/*!
+ * @brief キャッシュから一時保存データを取り出す (キャッシュからは削除する)
+ * @param savefile_id 保存フロアのファイルID
+ * @return 一時保存データ. キャッシュに無ければnullopt
+ */
+tl::optional<std::vector<byte>> SavedFloorCache::take(int savefile_id)
+{
+    const auto it = this->find_entry(savefile_id);
+    if (it == this->entries.end()) {
+        return tl::nullopt;
+    }
+
+    auto image = std::move(it->image);
+    this->memory_usage -= image.size();
+    this->entries.erase(it);
+    return image;
+}
+
+void SavedFloorCache::erase(int savefile_id)
+{
+    (void)this->take(savefile_id);
+}
+
+void SavedFloorCache::clear()
+{
+    this->entries.clear();
+    this->memory_usage = 0;
+}
+
+std::vector<SavedFloorCache::Entry>::iterator SavedFloorCache::find_entry(int savefile_id)
+{
+    return std::find_if(this->entries.begin(), this->entries.end(), [savefile_id](const auto &entry) { return entry.savefile_id == savefile_id; });
+}
+
+/*!
+ * @brief メモリ使用量が上限以下になるまで、最も長く使われていないものから一時ファイルへ書き出す
+ * @return 書き出しに失敗した保存フロアのファイルID
+ * @details 書き出しに失敗したものもキャッシュからは削除する. 呼び出し元でそのフロアを保存されていないものとして扱うこと.
+ */
+std::vector<int> SavedFloorCache::spill_over_budget()
+{
+    std::vector<int> failed_savefile_ids;
+    while (this->memory_usage > this->memory_budget) {
+        const auto it = std::min_element(this->entries.begin(), this->entries.end(), [](const auto &x, const auto &y) { return x.last_used < y.last_used; });
+        if (!this->spill(*it)) {
+            failed_savefile_ids.push_back(it->savefile_id);
+        }
+
+        this->memory_usage -= it->image.size();
+        this->entries.erase(it);
+    }
+
+    return failed_savefile_ids;
+}
+
+/*!
+ * @brief 一時保存データを一時ファイルへ書き出す
+ * @param entry 書き出すデータ
+ * @return 書き出せたらtrue
+ * @details 書き出しに失敗した場合は不完全なファイルを削除する.
+ */
+bool SavedFloorCache::spill(const Entry &entry) const
+{
+    safe_setuid_grab();
+    auto fd = fd_make(entry.path);
+    safe_setuid_drop();
+    if (fd < 0) {
+        return false;
+    }
+
+    (void)fd_close(fd);
+    safe_setuid_grab();
+    auto *fff = angband_fopen(entry.path, FileOpenMode::WRITE, true);
+    safe_setuid_drop();
+    if (fff == nullptr) {
+        return false;
+    }
+
+    auto is_successful = fwrite(entry.image.data(), 1, entry.image.size(), fff) == entry.image.size();
+    if (angband_fclose(fff)) {
+        is_successful = false;
+    }
+
+    if (!is_successful) {
+        safe_setuid_grab();
+        (void)fd_kill(entry.path);
+        safe_setuid_drop();
+    }
+
+    return is_successful;
+}
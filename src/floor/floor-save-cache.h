@@ -0,0 +1,52 @@
+#pragma once
+
+/*!
+ * @brief 保存フロアのメモリキャッシュ定義
+ * @details 離れたフロアの一時保存データ (一時ファイルと同一のバイト列) をメモリ上に保持する.
+ * メモリ使用量の上限を超えた場合は、最も長く使われていないものから一時ファイルに書き出す.
+ */
+
+#include "system/angband.h"
+#include <filesystem>
+#include <span>
+#include <tl/optional.hpp>
+#include <vector>
+
+class SavedFloorCache {
+public:
+    ~SavedFloorCache() = default;
+    SavedFloorCache(const SavedFloorCache &) = delete;
+    SavedFloorCache(SavedFloorCache &&) = delete;
+    SavedFloorCache &operator=(const SavedFloorCache &) = delete;
+    SavedFloorCache &operator=(SavedFloorCache &&) = delete;
+    static SavedFloorCache &get_instance();
+
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 16 * 1024 * 1024; //!< メモリ使用量の上限の既定値 (バイト)
+
+    void set_memory_budget(size_t budget);
+    std::vector<int> store(int savefile_id, const std::filesystem::path &path, std::vector<byte> &&image);
+    tl::optional<std::span<const byte>> find(int savefile_id);
+    tl::optional<std::vector<byte>> take(int savefile_id);
+    void erase(int savefile_id);
+    void clear();
+
+private:
+    static SavedFloorCache instance;
+    SavedFloorCache() = default;
+
+    struct Entry {
+        int savefile_id;
+        std::filesystem::path path; //!< 書き出す時の一時ファイル名
+        std::vector<byte> image; //!< 一時ファイルの内容
+        uint32_t last_used; //!< 最後に使用した時のカウンタ値
+    };
+
+    std::vector<Entry> entries;
+    size_t memory_budget = DEFAULT_MEMORY_BUDGET;
+    size_t memory_usage = 0;
+    uint32_t use_counter = 0;
+
+    std::vector<Entry>::iterator find_entry(int savefile_id);
+    std::vector<int> spill_over_budget();
+    bool spill(const Entry &entry) const;
+};
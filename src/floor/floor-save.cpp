@@ -12,6 +12,7 @@
 #include "floor/floor-save.h"
 #include "core/asking-player.h"
 #include "floor/floor-mode-changer.h"
+#include "floor/floor-save-cache.h"
 #include "floor/floor-save-util.h"
 #include "io/files-util.h"
 #include "io/uid-checker.h"
@@ -62,6 +63,7 @@ static void check_saved_tmp_files(const int fd, bool *force)
  */
 void init_saved_floors(bool force)
 {
+    SavedFloorCache::get_instance().clear();
     auto fd = -1;
     for (int i = 0; i < MAX_SAVED_FLOORS; i++) {
         saved_floor_type *sf_ptr = &saved_floors[i];
@@ -84,7 +86,7 @@ void init_saved_floors(bool force)
 }
 
 /*!
- * @brief 保存フロア用テンポラリファイルを削除する / Kill temporary files
+ * @brief 保存フロア用テンポラリファイル (及びメモリ上の保存フロア) を削除する / Kill temporary files
  * @details Should be called just before the game quit.
  * @param player_ptr プレイヤーへの参照ポインタ
  */
@@ -96,6 +98,7 @@ void clear_saved_floor_files(PlayerType *player_ptr)
             continue;
         }
 
+        SavedFloorCache::get_instance().erase(i);
         safe_setuid_grab();
         (void)fd_kill(get_saved_floor_name(i));
         safe_setuid_drop();
@@ -140,6 +143,7 @@ void kill_saved_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr)
         return;
     }
 
+    SavedFloorCache::get_instance().erase(sf_ptr->savefile_id);
     safe_setuid_grab();
     (void)fd_kill(get_saved_floor_name((int)sf_ptr->savefile_id));
     safe_setuid_drop();
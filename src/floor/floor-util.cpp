@@ -95,11 +95,10 @@ void update_smell(FloorType &floor, const Pos2D &p_pos)
 void forget_flow(FloorType &floor)
 {
     for (const auto &pos : floor.get_area()) {
-        auto &grid = floor.get_grid(pos);
-        grid.reset_costs();
-        grid.reset_dists();
-        grid.when = 0;
+        floor.get_grid(pos).when = 0;
     }
+
+    floor.get_flow_field().reset();
 }
 
 /*!
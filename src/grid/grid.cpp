@@ -27,7 +27,6 @@
 #include "player/player-status-flags.h"
 #include "player/player-status.h"
 #include "system/dungeon/dungeon-definition.h"
-#include "system/enums/grid-flow.h"
 #include "system/enums/terrain/terrain-tag.h"
 #include "system/floor/floor-info.h"
 #include "system/grid-type-definition.h"
@@ -42,17 +41,8 @@
 #include "view/display-map.h"
 #include "view/display-messages.h"
 #include "window/main-window-util.h"
+#include "window/overhead-map-cache.h"
 #include "world/world.h"
-#include <queue>
-
-bool GridTemplate::matches(const Grid &grid) const
-{
-    auto is_matched = this->info == grid.info;
-    is_matched &= this->feat == grid.feat;
-    is_matched &= this->mimic == grid.mimic;
-    is_matched &= this->special == grid.special;
-    return is_matched;
-}
 
 void set_terrain_id_to_grid(PlayerType *player_ptr, const Pos2D &pos, TerrainTag tag)
 {
@@ -107,6 +97,7 @@ void set_terrain_id_to_grid(PlayerType *player_ptr, const Pos2D &pos, short terr
         update_monster(player_ptr, grid.m_idx, false);
     }
 
+    floor.get_flow_field().notice_terrain_change(pos);
     note_spot(player_ptr, pos);
     lite_spot(player_ptr, pos);
     if (old_los ^ terrain.flags.has(TerrainCharacteristics::LOS)) {
@@ -432,6 +423,7 @@ void note_spot(PlayerType *player_ptr, const Pos2D &pos)
 
     /* Memorize terrain of the grid */
     grid.info |= (CAVE_KNOWN);
+    OverheadMapCache::get_instance().set_dirty(pos);
 }
 
 /*
@@ -441,6 +433,7 @@ void note_spot(PlayerType *player_ptr, const Pos2D &pos)
  */
 void lite_spot(PlayerType *player_ptr, const Pos2D &pos)
 {
+    OverheadMapCache::get_instance().set_dirty(pos);
     if (panel_contains(pos) && player_ptr->current_floor_ptr->contains(pos, FloorBoundary::OUTER_WALL_INCLUSIVE)) {
         auto symbol_pair = map_info(player_ptr, pos);
         symbol_pair.symbol_foreground.color = get_monochrome_display_color(player_ptr).value_or(symbol_pair.symbol_foreground.color);
@@ -660,14 +653,6 @@ void lite_spot(PlayerType *player_ptr, const Pos2D &pos)
  * Oh, and outside of the "torch radius", only "lite" grids need to be scanned.
  */
 
-/*
- * Hack - speed up the update_flow algorithm by only doing
- * it everytime the player moves out of LOS of the last
- * "way-point".
- */
-static POSITION flow_x = 0;
-static POSITION flow_y = 0;
-
 /*
  * Hack -- fill in the "cost" field of every grid that the player
  * can "reach" with the number of steps needed to reach that grid.
@@ -680,98 +665,30 @@ static POSITION flow_y = 0;
  *
  * We do not need a priority queue because the cost from grid
  * to grid is always "one" and we process them in order.
+ * All kinds of GridFlow are searched at once (see FlowField::update()).
+ *
+ * Hack - speed up the update_flow algorithm by only doing
+ * it everytime the player moves out of LOS of the last
+ * "way-point" while running, unless the terrain around it has changed.
+ *
+ * The search never goes further than MAX_FLOW_DEPTH steps from the way-point,
+ * so only that window around the last way-point needs to be erased.
  */
 void update_flow(PlayerType *player_ptr)
 {
     auto &floor = *player_ptr->current_floor_ptr;
+    auto &flow_field = floor.get_flow_field();
 
     /* The last way-point is on the map */
-    const Pos2D flow(flow_y, flow_x);
-    if (player_ptr->running && floor.contains(flow, FloorBoundary::OUTER_WALL_EXCLUSIVE)) {
+    const auto &flow = flow_field.get_origin();
+    if (player_ptr->running && flow && !flow_field.is_stale() && floor.contains(*flow, FloorBoundary::OUTER_WALL_EXCLUSIVE)) {
         /* The way point is in sight - do not update.  (Speedup) */
-        if (floor.get_grid(flow).info & CAVE_VIEW) {
+        if (floor.get_grid(*flow).info & CAVE_VIEW) {
             return;
         }
     }
 
-    /* Erase all of the current flow information */
-    for (const auto &pos : floor.get_area()) {
-        auto &grid = floor.get_grid(pos);
-        grid.reset_costs();
-        grid.reset_dists();
-    }
-
-    /* Save player position */
-    flow_y = player_ptr->y;
-    flow_x = player_ptr->x;
-
-    for (const auto gf : GRID_FLOW_RANGE) {
-        // 幅優先探索用のキュー。
-        std::queue<Pos2D> que;
-        que.emplace(player_ptr->y, player_ptr->x);
-
-        /* Now process the queue */
-        while (!que.empty()) {
-            const Pos2D pos = std::move(que.front());
-            que.pop();
-            const auto &grid = floor.get_grid(pos);
-
-            /* Add the "children" */
-            for (const auto &d : Direction::directions_8()) {
-                uint8_t m = grid.costs.at(gf) + 1;
-                const uint8_t n = grid.dists.at(gf) + 1;
-                const auto pos_neighbor = pos + d.vec();
-
-                /* Ignore player's grid */
-                if (player_ptr->is_located_at(pos_neighbor)) {
-                    continue;
-                }
-
-                if (floor.has_closed_door_at(pos_neighbor)) {
-                    m += 3;
-                }
-
-                /* Ignore "pre-stamped" entries */
-                auto &grid_neighbor = floor.get_grid(pos_neighbor);
-                auto &cost_neighbor = grid_neighbor.costs.at(gf);
-                auto &dist_neighbor = grid_neighbor.dists.at(gf);
-                if ((dist_neighbor != 0) && (dist_neighbor <= n) && (cost_neighbor <= m)) {
-                    continue;
-                }
-
-                /* Ignore "walls", "holes" and "rubble" */
-                auto can_move = false;
-                switch (gf) {
-                case GridFlow::CAN_FLY:
-                    can_move = grid_neighbor.has(TerrainCharacteristics::MOVE) || grid_neighbor.has(TerrainCharacteristics::CAN_FLY);
-                    break;
-                default:
-                    can_move = grid_neighbor.has(TerrainCharacteristics::MOVE);
-                    break;
-                }
-
-                if (!can_move && !floor.has_closed_door_at(pos_neighbor)) {
-                    continue;
-                }
-
-                /* Save the flow cost */
-                if (cost_neighbor == 0 || (cost_neighbor > m)) {
-                    cost_neighbor = m;
-                }
-                if (dist_neighbor == 0 || (dist_neighbor > n)) {
-                    dist_neighbor = n;
-                }
-
-                // 敵のプレイヤーに対する移動道のりの最大値(この値以上は処理を打ち切る).
-                constexpr auto monster_flow_depth = 32;
-                if (n == monster_flow_depth) {
-                    continue;
-                }
-
-                que.emplace(pos_neighbor);
-            }
-        }
-    }
+    flow_field.update(floor, player_ptr->get_position());
 }
 
 /*
@@ -14,7 +14,6 @@
 #include <tl/optional.hpp>
 
 enum class AttributeType;
-class Grid;
 class GridTemplate {
 public:
     GridTemplate()
@@ -36,8 +35,6 @@ public:
     FEAT_IDX mimic;
     short special;
     uint16_t occurrence;
-
-    bool matches(const Grid &grid) const;
 };
 
 enum grid_bold_type {
@@ -13,7 +13,6 @@
 #include "system/terrain/terrain-list.h"
 #include "util/enum-converter.h"
 #include "util/string-processor.h"
-#include "view/display-messages.h"
 #include <span>
 
 /*!
@@ -28,7 +27,7 @@ static bool grab_one_dungeon_flag(DungeonDefinition &dungeon, std::string_view w
         return true;
     }
 
-    msg_format(_("未知のダンジョン・フラグ '%s'。", "Unknown dungeon type flag '%s'."), what.data());
+    info_error_format(_("未知のダンジョン・フラグ '%s'。", "Unknown dungeon type flag '%s'."), what.data());
     return false;
 }
 
@@ -87,7 +86,7 @@ static bool grab_one_basic_monster_flag(DungeonDefinition &dungeon, std::string_
         return true;
     }
 
-    msg_format(_("未知のモンスター・フラグ '%s'。", "Unknown monster flag '%s'."), what.data());
+    info_error_format(_("未知のモンスター・フラグ '%s'。", "Unknown monster flag '%s'."), what.data());
     return false;
 }
 
@@ -103,7 +102,7 @@ static bool grab_one_spell_monster_flag(DungeonDefinition &dungeon, std::string_
         return true;
     }
 
-    msg_format(_("未知のモンスター・フラグ '%s'。", "Unknown monster flag '%s'."), what.data());
+    info_error_format(_("未知のモンスター・フラグ '%s'。", "Unknown monster flag '%s'."), what.data());
     return false;
 }
 
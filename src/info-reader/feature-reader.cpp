@@ -11,7 +11,6 @@
 #include "term/gameterm.h"
 #include "util/bit-flags-calculator.h"
 #include "util/string-processor.h"
-#include "view/display-messages.h"
 #include <map>
 #include <set>
 
@@ -28,7 +27,7 @@ static bool grab_one_feat_flag(TerrainType *f_ptr, std::string_view what)
         return true;
     }
 
-    msg_format(_("未知の地形フラグ '%s'。", "Unknown feature flag '%s'."), what.data());
+    info_error_format(_("未知の地形フラグ '%s'。", "Unknown feature flag '%s'."), what.data());
     return false;
 }
 
@@ -47,7 +46,7 @@ static bool grab_one_feat_action(TerrainType *f_ptr, std::string_view what, int
         return true;
     }
 
-    msg_format(_("未知の地形アクション '%s'。", "Unknown feature action '%s'."), what.data());
+    info_error_format(_("未知の地形アクション '%s'。", "Unknown feature action '%s'."), what.data());
     return false;
 }
 
@@ -0,0 +1,265 @@
+/*!
+ * @file info-cache-tables.cpp
+ * @brief バイナリキャッシュに保存するゲームデータの読み書き処理実装
+ * @details 各 archive_* 関数は InfoCacheWriter と InfoCacheReader の両方で使い、書き込みと読み込みのフィールド順を一致させる.
+ * フィールドの型と並びはキャッシュの書式の指紋に含まれるが、フィールドを増減したら info-cache.cpp のキャッシュ書式バージョンも上げること.
+ * ゲーム中に変化する状態 (生成済フラグ、現在数、思い出など) はセーブファイルの管轄なので保存しない.
+ */
+
+#include "info-reader/info-cache-tables.h"
+#include "monster-race/race-sex.h"
+#include "monster-race/race-speak-flags.h"
+#include "system/artifact-type-definition.h"
+#include "system/baseitem/baseitem-definition.h"
+#include "system/baseitem/baseitem-list.h"
+#include "system/monrace/monrace-definition.h"
+#include "system/monrace/monrace-list.h"
+#include "system/monrace/monrace-message.h"
+#include "util/enum-converter.h"
+
+namespace {
+template <typename Archive>
+void archive_artifact(Archive &ar, ArtifactType &artifact)
+{
+    ar(artifact.name, artifact.text, artifact.bi_key, artifact.pval, artifact.to_h, artifact.to_d, artifact.to_a, artifact.ac);
+    ar(artifact.damage_dice, artifact.weight, artifact.cost, artifact.flags, artifact.gen_flags, artifact.level, artifact.rarity);
+    ar(artifact.act_idx);
+}
+
+template <typename Archive>
+void archive_baseitem(Archive &ar, BaseitemDefinition &baseitem)
+{
+    ar(baseitem.idx, baseitem.name, baseitem.text, baseitem.flavor_name, baseitem.bi_key, baseitem.pval);
+    ar(baseitem.to_h, baseitem.to_d, baseitem.to_a, baseitem.ac, baseitem.damage_dice, baseitem.weight, baseitem.cost);
+    ar(baseitem.flags, baseitem.gen_flags, baseitem.level);
+    for (auto &alloc_table : baseitem.alloc_tables) {
+        ar(alloc_table.level, alloc_table.chance);
+    }
+
+    ar(baseitem.symbol_definition, baseitem.easy_know, baseitem.act_idx, baseitem.symbol_config);
+}
+
+/*!
+ * @brief モンスター種族定義の公開フィールドを読み書きする
+ * @details 非公開のフィールド (ドロップアーティファクト/護衛/死亡召喚/性別) は write_monrace() / read_monrace() で扱う.
+ */
+template <typename Archive>
+void archive_monrace(Archive &ar, MonraceDefinition &monrace)
+{
+    ar(monrace.idx, monrace.name, monrace.text, monrace.hit_dice, monrace.ac, monrace.sleep, monrace.aaf, monrace.speed, monrace.mexp, monrace.freq_spell);
+    ar(monrace.ability_flags, monrace.aura_flags, monrace.behavior_flags, monrace.visual_flags, monrace.kind_flags, monrace.resistance_flags);
+    ar(monrace.drop_flags, monrace.wilderness_flags, monrace.feature_flags, monrace.population_flags, monrace.speak_flags);
+    ar(monrace.brightness_flags, monrace.special_flags, monrace.misc_flags);
+    for (auto &blow : monrace.blows) {
+        ar(blow.method, blow.effect, blow.damage_dice);
+    }
+
+    ar(monrace.shoot_damage_dice, monrace.arena_ratio, monrace.next_r_idx, monrace.next_exp, monrace.level, monrace.rarity);
+    ar(monrace.symbol_definition, monrace.symbol_config, monrace.max_num, monrace.cur_hp_per);
+}
+
+void write_monrace(InfoCacheWriter &writer, MonraceDefinition &monrace)
+{
+    archive_monrace(writer, monrace);
+    const auto &drop_artifacts = monrace.get_drop_artifacts();
+    writer(static_cast<uint32_t>(drop_artifacts.size()));
+    for (const auto &drop_artifact : drop_artifacts) {
+        writer(drop_artifact.fa_id, drop_artifact.chance);
+    }
+
+    const auto &reinforces = monrace.get_reinforces();
+    writer(static_cast<uint32_t>(reinforces.size()));
+    for (const auto &reinforce : reinforces) {
+        writer(reinforce.get_monrace_id(), reinforce.get_dice());
+    }
+
+    const auto &final_summons = monrace.get_final_summons();
+    writer(static_cast<uint32_t>(final_summons.size()));
+    for (const auto &summon : final_summons) {
+        writer(summon.id, summon.probability, summon.min_num, summon.max_num, summon.radius);
+    }
+
+    const auto sex = monrace.is_male() ? MonsterSex::MALE : (monrace.is_female() ? MonsterSex::FEMALE : MonsterSex::NONE);
+    writer(sex);
+}
+
+void read_monrace(InfoCacheReader &reader, MonraceDefinition &monrace)
+{
+    archive_monrace(reader, monrace);
+    const auto drop_artifacts_size = reader.read_value<uint32_t>();
+    for (uint32_t i = 0; (i < drop_artifacts_size) && reader.is_valid(); i++) {
+        const auto fa_id = reader.read_value<FixedArtifactId>();
+        const auto chance = reader.read_value<int>();
+        monrace.emplace_drop_artifact(fa_id, chance);
+    }
+
+    const auto reinforces_size = reader.read_value<uint32_t>();
+    for (uint32_t i = 0; (i < reinforces_size) && reader.is_valid(); i++) {
+        const auto monrace_id = reader.read_value<MonraceId>();
+        const auto dice = reader.read_value<Dice>();
+        monrace.emplace_reinforce(monrace_id, dice);
+    }
+
+    const auto final_summons_size = reader.read_value<uint32_t>();
+    for (uint32_t i = 0; (i < final_summons_size) && reader.is_valid(); i++) {
+        const auto id = reader.read_value<MonraceId>();
+        const auto probability = reader.read_value<int>();
+        const auto min_num = reader.read_value<int>();
+        const auto max_num = reader.read_value<int>();
+        const auto radius = reader.read_value<int>();
+        monrace.emplace_final_summon(id, probability, min_num, max_num, radius);
+    }
+
+    const auto sex = reader.read_value<MonsterSex>();
+    if ((sex >= MonsterSex::NONE) && (sex < MonsterSex::MAX)) {
+        monrace.init_sex(enum2i(sex));
+    }
+}
+
+/*!
+ * @brief モンスター種族定義と同時に登録された種族別メッセージを書き込む
+ * @details MonsterMessages.jsonc はモンスター種族定義より後に読み込むので、この時点では種族定義由来のメッセージしか登録されていない.
+ */
+void write_monrace_messages(InfoCacheWriter &writer)
+{
+    const auto &monrace_messages = MonraceMessageList::get_instance().get_messages();
+    writer(static_cast<uint32_t>(monrace_messages.size()));
+    for (const auto &[monrace_id, monrace_message] : monrace_messages) {
+        const auto &messages = monrace_message.get_messages();
+        writer(monrace_id, static_cast<uint32_t>(messages.size()));
+        for (const auto &[message_type, message_list] : messages) {
+            const auto &message_objs = message_list.get_messages();
+            writer(message_type, static_cast<uint32_t>(message_objs.size()));
+            for (const auto &message_obj : message_objs) {
+                writer(message_obj.get_chance(), message_obj.start_with_monname(), message_obj.get_message_text());
+            }
+        }
+    }
+}
+
+/*!
+ * @brief キャッシュ対象のクラスの構成の指紋を計算する
+ * @param archive フィールドを読み書きする関数
+ * @return 読み書きするフィールドの型の並びとクラスのサイズから計算した指紋
+ */
+template <typename T, typename ArchiveFunc>
+uint64_t calc_layout_fingerprint(ArchiveFunc archive)
+{
+    InfoCacheFingerprint fingerprint;
+    T definition;
+    archive(fingerprint, definition);
+    fingerprint(definition);
+    return fingerprint.get_value();
+}
+
+void read_monrace_messages(InfoCacheReader &reader)
+{
+    auto &monrace_messages = MonraceMessageList::get_instance();
+    const auto monraces_size = reader.read_value<uint32_t>();
+    for (uint32_t i = 0; (i < monraces_size) && reader.is_valid(); i++) {
+        const auto monrace_id = reader.read_value<int>();
+        const auto message_types_size = reader.read_value<uint32_t>();
+        for (uint32_t j = 0; (j < message_types_size) && reader.is_valid(); j++) {
+            const auto message_type = reader.read_value<MonsterMessageType>();
+            const auto messages_size = reader.read_value<uint32_t>();
+            for (uint32_t k = 0; (k < messages_size) && reader.is_valid(); k++) {
+                const auto chance = reader.read_value<int>();
+                const auto use_name = reader.read_value<bool>();
+                const auto message = reader.read_value<std::string>();
+                monrace_messages.emplace(monrace_id, message_type, chance, use_name, message);
+            }
+        }
+    }
+}
+}
+
+/*!
+ * @brief 固定アーティファクト定義のキャッシュ読み書き処理を生成する
+ */
+InfoCacheTable create_artifacts_cache_table()
+{
+    const auto write = [](InfoCacheWriter &writer) {
+        auto &artifacts = ArtifactList::get_instance();
+        writer(static_cast<uint32_t>(artifacts.size()));
+        for (auto &[fa_id, artifact] : artifacts) {
+            writer(fa_id);
+            archive_artifact(writer, artifact);
+        }
+    };
+    const auto read = [](InfoCacheReader &reader) {
+        auto &artifacts = ArtifactList::get_instance();
+        const auto size = reader.read_value<uint32_t>();
+        for (uint32_t i = 0; (i < size) && reader.is_valid(); i++) {
+            const auto fa_id = reader.read_value<FixedArtifactId>();
+            ArtifactType artifact;
+            archive_artifact(reader, artifact);
+            artifacts.emplace(fa_id, std::move(artifact));
+        }
+    };
+    const auto layout_fingerprint = calc_layout_fingerprint<ArtifactType>(archive_artifact<InfoCacheFingerprint>);
+    return { write, read, [] { ArtifactList::get_instance().clear(); }, layout_fingerprint };
+}
+
+/*!
+ * @brief ベースアイテム定義のキャッシュ読み書き処理を生成する
+ */
+InfoCacheTable create_baseitems_cache_table()
+{
+    const auto write = [](InfoCacheWriter &writer) {
+        auto &baseitems = BaseitemList::get_instance();
+        writer(static_cast<uint32_t>(baseitems.size()));
+        for (auto &baseitem : baseitems) {
+            archive_baseitem(writer, baseitem);
+        }
+    };
+    const auto read = [](InfoCacheReader &reader) {
+        auto &baseitems = BaseitemList::get_instance();
+        const auto size = reader.read_value<uint32_t>();
+        if (!reader.is_valid()) {
+            return;
+        }
+
+        baseitems.resize(size);
+        for (auto &baseitem : baseitems) {
+            archive_baseitem(reader, baseitem);
+        }
+    };
+    const auto layout_fingerprint = calc_layout_fingerprint<BaseitemDefinition>(archive_baseitem<InfoCacheFingerprint>);
+    return { write, read, [] { BaseitemList::get_instance().resize(0); }, layout_fingerprint };
+}
+
+/*!
+ * @brief モンスター種族定義と種族別メッセージのキャッシュ読み書き処理を生成する
+ */
+InfoCacheTable create_monraces_cache_table()
+{
+    const auto write = [](InfoCacheWriter &writer) {
+        auto &monraces = MonraceList::get_instance();
+        writer(static_cast<uint32_t>(monraces.size()));
+        for (auto &[monrace_id, monrace] : monraces) {
+            writer(monrace_id);
+            write_monrace(writer, monrace);
+        }
+
+        write_monrace_messages(writer);
+    };
+    const auto read = [](InfoCacheReader &reader) {
+        auto &monraces = MonraceList::get_instance();
+        const auto size = reader.read_value<uint32_t>();
+        for (uint32_t i = 0; (i < size) && reader.is_valid(); i++) {
+            auto &monrace = monraces.emplace(reader.read_value<MonraceId>());
+            read_monrace(reader, monrace);
+        }
+
+        read_monrace_messages(reader);
+    };
+    const auto clear = [] {
+        MonraceList::get_instance().clear();
+        MonraceMessageList::get_instance().clear();
+    };
+    const auto layout_fingerprint = calc_layout_fingerprint<MonraceDefinition>([](InfoCacheFingerprint &fingerprint, MonraceDefinition &monrace) {
+        archive_monrace(fingerprint, monrace);
+        fingerprint(monrace.get_drop_artifacts(), monrace.get_reinforces(), monrace.get_final_summons());
+    });
+    return { write, read, clear, layout_fingerprint };
+}
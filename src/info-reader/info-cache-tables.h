@@ -0,0 +1,12 @@
+#pragma once
+
+/*!
+ * @file info-cache-tables.h
+ * @brief バイナリキャッシュに保存するゲームデータの読み書き処理定義
+ */
+
+#include "info-reader/info-cache.h"
+
+InfoCacheTable create_artifacts_cache_table();
+InfoCacheTable create_baseitems_cache_table();
+InfoCacheTable create_monraces_cache_table();
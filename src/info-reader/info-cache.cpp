@@ -0,0 +1,268 @@
+/*!
+ * @file info-cache.cpp
+ * @brief ゲームデータ (lib/edit) の解析結果を保存するバイナリキャッシュの実装
+ */
+
+#include "info-reader/info-cache.h"
+#include "io/files-util.h"
+#include "io/uid-checker.h"
+#include "locale/character-encoding.h"
+#include "system/angband-version.h"
+#include "util/angband-files.h"
+#include <fstream>
+
+namespace {
+constexpr std::array<char, 4> INFO_CACHE_MAGIC{ { 'H', 'B', 'I', 'C' } };
+constexpr uint32_t INFO_CACHE_FORMAT_VERSION = 4; //!< キャッシュの書式やキャッシュ対象のクラスの構成を変えたら上げること
+
+#ifdef JP
+#ifdef EUC
+constexpr auto INFO_CACHE_ENCODING = CharacterEncoding::EUC_JP;
+#endif
+#ifdef SJIS
+constexpr auto INFO_CACHE_ENCODING = CharacterEncoding::SHIFT_JIS;
+#endif
+#else
+constexpr auto INFO_CACHE_ENCODING = CharacterEncoding::US_ASCII;
+#endif
+
+/*!
+ * @brief キャッシュファイルのヘッダ
+ * @details 書式・ゲームのバージョン・文字コード・キャッシュ対象のクラスの構成のいずれかが異なるか、
+ * 解析元ファイルのハッシュ値が異なればキャッシュは使わない.
+ */
+struct InfoCacheHeader {
+    std::array<char, 4> magic;
+    uint32_t format_version;
+    std::array<uint8_t, 4> game_version;
+    CharacterEncoding encoding;
+    uint64_t layout_fingerprint;
+    util::SHA256::Digest source_digest;
+    uint64_t payload_size;
+    uint64_t payload_checksum;
+};
+
+InfoCacheHeader create_header(const util::SHA256::Digest &source_digest, uint64_t layout_fingerprint, std::span<const std::byte> payload)
+{
+    InfoCacheHeader header{};
+    header.magic = INFO_CACHE_MAGIC;
+    header.format_version = INFO_CACHE_FORMAT_VERSION;
+    header.game_version = { { H_VER_MAJOR, H_VER_MINOR, H_VER_PATCH, H_VER_EXTRA } };
+    header.encoding = INFO_CACHE_ENCODING;
+    header.layout_fingerprint = layout_fingerprint;
+    header.source_digest = source_digest;
+    header.payload_size = payload.size();
+
+    /* 書き込み途中のファイルなどを弾くためのチェックサム (FNV-1a) */
+    uint64_t checksum = 0xcbf29ce484222325ULL;
+    for (const auto b : payload) {
+        checksum = (checksum ^ std::to_integer<uint64_t>(b)) * 0x100000001b3ULL;
+    }
+
+    header.payload_checksum = checksum;
+    return header;
+}
+
+bool operator==(const InfoCacheHeader &x, const InfoCacheHeader &y)
+{
+    auto is_equal = (x.magic == y.magic) && (x.format_version == y.format_version);
+    is_equal &= (x.game_version == y.game_version) && (x.encoding == y.encoding);
+    is_equal &= (x.layout_fingerprint == y.layout_fingerprint);
+    is_equal &= (x.source_digest == y.source_digest);
+    return is_equal && (x.payload_size == y.payload_size) && (x.payload_checksum == y.payload_checksum);
+}
+
+std::filesystem::path get_info_cache_path(std::string_view filename)
+{
+    const auto stem = std::filesystem::path(filename).stem().string();
+    return path_build(ANGBAND_DIR_DATA, stem + _("_j.cache", ".cache"));
+}
+}
+
+const std::vector<std::byte> &InfoCacheWriter::get_bytes() const
+{
+    return this->bytes;
+}
+
+void InfoCacheWriter::write(std::string_view str)
+{
+    this->write(static_cast<uint32_t>(str.size()));
+    const auto *begin = reinterpret_cast<const std::byte *>(str.data());
+    this->bytes.insert(this->bytes.end(), begin, begin + str.size());
+}
+
+void InfoCacheWriter::write(const LocalizedString &str)
+{
+    this->write(str.string());
+    this->write(str.en_string());
+}
+
+void InfoCacheWriter::write(const Dice &dice)
+{
+    this->write(dice.num);
+    this->write(dice.sides);
+}
+
+void InfoCacheWriter::write(const DisplaySymbol &symbol)
+{
+    this->write(symbol.color);
+    this->write(symbol.character);
+}
+
+void InfoCacheWriter::write(const BaseitemKey &bi_key)
+{
+    const auto sval = bi_key.sval();
+    this->write(bi_key.tval());
+    this->write(sval.has_value());
+    this->write(sval.value_or(0));
+}
+
+uint64_t InfoCacheFingerprint::get_value() const
+{
+    return this->value;
+}
+
+void InfoCacheFingerprint::add(std::string_view type_name, size_t size)
+{
+    const auto mix = [this](uint64_t byte) { this->value = (this->value ^ byte) * 0x100000001b3ULL; };
+    for (const auto c : type_name) {
+        mix(static_cast<uint8_t>(c));
+    }
+
+    for (auto i = 0U; i < sizeof(uint64_t); i++) {
+        mix((static_cast<uint64_t>(size) >> (i * 8)) & 0xff);
+    }
+}
+
+InfoCacheReader::InfoCacheReader(std::span<const std::byte> bytes)
+    : bytes(bytes)
+{
+}
+
+bool InfoCacheReader::is_valid() const
+{
+    return this->valid;
+}
+
+/*!
+ * @brief 全てのデータを過不足なく読み込んだかを返す
+ */
+bool InfoCacheReader::is_end() const
+{
+    return this->valid && (this->pos == this->bytes.size());
+}
+
+/*!
+ * @brief 指定したバイト数を読み進める
+ * @param size 読み進めるバイト数
+ * @return 読み進めた範囲. 範囲外に出る場合は空のspanを返し、以降の読み込みを全て無効にする.
+ */
+std::span<const std::byte> InfoCacheReader::take(size_t size)
+{
+    if (!this->valid || (size > this->bytes.size() - this->pos)) {
+        this->valid = false;
+        return {};
+    }
+
+    const auto span = this->bytes.subspan(this->pos, size);
+    this->pos += size;
+    return span;
+}
+
+void InfoCacheReader::read(std::string &str)
+{
+    const auto size = this->read_value<uint32_t>();
+    const auto span = this->take(size);
+    str.assign(reinterpret_cast<const char *>(span.data()), span.size());
+}
+
+void InfoCacheReader::read(LocalizedString &str)
+{
+    const auto localized = this->read_value<std::string>();
+    const auto english = this->read_value<std::string>();
+    str = LocalizedString(localized, english);
+}
+
+void InfoCacheReader::read(Dice &dice)
+{
+    this->read(dice.num);
+    this->read(dice.sides);
+}
+
+void InfoCacheReader::read(DisplaySymbol &symbol)
+{
+    this->read(symbol.color);
+    this->read(symbol.character);
+}
+
+void InfoCacheReader::read(BaseitemKey &bi_key)
+{
+    const auto tval = this->read_value<ItemKindType>();
+    const auto has_sval = this->read_value<bool>();
+    const auto sval = this->read_value<int>();
+    bi_key = has_sval ? BaseitemKey(tval, sval) : BaseitemKey(tval);
+}
+
+/*!
+ * @brief キャッシュファイルを読み込む
+ * @param filename 解析元ファイル名 (lib/edit からの相対パス)
+ * @param source_digest 解析元ファイルのハッシュ値
+ * @param layout_fingerprint キャッシュ対象のクラスの構成の指紋
+ * @return キャッシュの内容. キャッシュが無いか、解析元ファイルやゲームのバージョンと合わない場合はnullopt
+ */
+tl::optional<std::vector<std::byte>> read_info_cache(std::string_view filename, const util::SHA256::Digest &source_digest, uint64_t layout_fingerprint)
+{
+    std::ifstream ifs(get_info_cache_path(filename), std::ios::binary);
+    if (!ifs) {
+        return tl::nullopt;
+    }
+
+    InfoCacheHeader header{};
+    if (!ifs.read(reinterpret_cast<char *>(&header), sizeof(header)) || (header.source_digest != source_digest)) {
+        return tl::nullopt;
+    }
+
+    std::vector<std::byte> payload(header.payload_size);
+    if (!ifs.read(reinterpret_cast<char *>(payload.data()), payload.size()) || (ifs.peek() != std::ifstream::traits_type::eof())) {
+        return tl::nullopt;
+    }
+
+    if (!(create_header(source_digest, layout_fingerprint, payload) == header)) {
+        return tl::nullopt;
+    }
+
+    return payload;
+}
+
+/*!
+ * @brief キャッシュファイルを書き込む
+ * @param filename 解析元ファイル名 (lib/edit からの相対パス)
+ * @param source_digest 解析元ファイルのハッシュ値
+ * @param layout_fingerprint キャッシュ対象のクラスの構成の指紋
+ * @param payload キャッシュの内容
+ * @details 一時ファイルに書き込んでから置き換える. lib/data に書き込めない場合は何もしない.
+ */
+void write_info_cache(std::string_view filename, const util::SHA256::Digest &source_digest, uint64_t layout_fingerprint, std::span<const std::byte> payload)
+{
+    const auto path = get_info_cache_path(filename);
+    auto path_tmp = path;
+    path_tmp += ".tmp";
+    const auto header = create_header(source_digest, layout_fingerprint, payload);
+    safe_setuid_grab();
+    auto *fff = angband_fopen(path_tmp, FileOpenMode::WRITE, true);
+    safe_setuid_drop();
+    if (fff == nullptr) {
+        return;
+    }
+
+    auto is_successful = fwrite(&header, sizeof(header), 1, fff) == 1;
+    is_successful &= fwrite(payload.data(), 1, payload.size(), fff) == payload.size();
+    is_successful &= angband_fclose(fff) == 0;
+    safe_setuid_grab();
+    if (is_successful) {
+        fd_move(path_tmp, path);
+    }
+
+    fd_kill(path_tmp);
+    safe_setuid_drop();
+}
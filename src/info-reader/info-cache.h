@@ -0,0 +1,189 @@
+#pragma once
+
+/*!
+ * @file info-cache.h
+ * @brief ゲームデータ (lib/edit) の解析結果を保存するバイナリキャッシュの定義
+ * @details 解析元ファイルのSHA-256ハッシュ値をキーとして lib/data に保存する.
+ * 内容は実行環境の型表現そのままなので、異なるプラットフォーム間での互換性はない.
+ */
+
+#include "locale/localized-string.h"
+#include "system/angband.h"
+#include "system/baseitem/baseitem-key.h"
+#include "util/dice.h"
+#include "util/flag-group.h"
+#include "util/sha256.h"
+#include "view/display-symbol.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tl/optional.hpp>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+/*!
+ * @brief キャッシュの書き込み先
+ * @details writer(a, b, c) のように、書き込む値を並べて呼び出す.
+ */
+class InfoCacheWriter {
+public:
+    template <typename... Args>
+    void operator()(const Args &...args)
+    {
+        (this->write(args), ...);
+    }
+
+    const std::vector<std::byte> &get_bytes() const;
+
+private:
+    std::vector<std::byte> bytes;
+
+    template <typename T>
+        requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+    void write(T value)
+    {
+        const auto *begin = reinterpret_cast<const std::byte *>(&value);
+        this->bytes.insert(this->bytes.end(), begin, begin + sizeof(T));
+    }
+
+    template <typename T, size_t N>
+    void write(const T (&values)[N])
+    {
+        for (const auto &value : values) {
+            this->write(value);
+        }
+    }
+
+    template <typename T, size_t N>
+    void write(const std::array<T, N> &values)
+    {
+        for (const auto &value : values) {
+            this->write(value);
+        }
+    }
+
+    template <typename FlagType, FlagType MAX>
+    void write(const FlagGroup<FlagType, MAX> &flags)
+    {
+        wr_FlagGroup(flags, [this](uint8_t value) { this->write(value); });
+    }
+
+    void write(std::string_view str);
+    void write(const LocalizedString &str);
+    void write(const Dice &dice);
+    void write(const DisplaySymbol &symbol);
+    void write(const BaseitemKey &bi_key);
+};
+
+/*!
+ * @brief キャッシュの読み込み元
+ * @details reader(a, b, c) のように、InfoCacheWriter で書き込んだ順に変数を並べて呼び出す.
+ * 範囲外を読もうとした場合は以降の読み込みを全て無視し、is_valid() が false を返す.
+ */
+class InfoCacheReader {
+public:
+    explicit InfoCacheReader(std::span<const std::byte> bytes);
+
+    template <typename... Args>
+    void operator()(Args &...args)
+    {
+        (this->read(args), ...);
+    }
+
+    template <typename T>
+    T read_value()
+    {
+        T value{};
+        this->read(value);
+        return value;
+    }
+
+    bool is_valid() const;
+    bool is_end() const;
+
+private:
+    std::span<const std::byte> bytes;
+    size_t pos = 0;
+    bool valid = true;
+
+    std::span<const std::byte> take(size_t size);
+
+    template <typename T>
+        requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+    void read(T &value)
+    {
+        const auto span = this->take(sizeof(T));
+        if (!span.empty()) {
+            std::copy(span.begin(), span.end(), reinterpret_cast<std::byte *>(&value));
+        }
+    }
+
+    template <typename T, size_t N>
+    void read(T (&values)[N])
+    {
+        for (auto &value : values) {
+            this->read(value);
+        }
+    }
+
+    template <typename T, size_t N>
+    void read(std::array<T, N> &values)
+    {
+        for (auto &value : values) {
+            this->read(value);
+        }
+    }
+
+    template <typename FlagType, FlagType MAX>
+    void read(FlagGroup<FlagType, MAX> &flags)
+    {
+        rd_FlagGroup(flags, [this] { return this->read_value<uint8_t>(); });
+    }
+
+    void read(std::string &str);
+    void read(LocalizedString &str);
+    void read(Dice &dice);
+    void read(DisplaySymbol &symbol);
+    void read(BaseitemKey &bi_key);
+};
+
+/*!
+ * @brief キャッシュの書式の指紋
+ * @details InfoCacheWriter の代わりに渡すと、読み書きするフィールドの型とサイズを順に記録してハッシュ値にする.
+ * キャッシュ対象のクラスのフィールドを増減・変更した時に、書式バージョンを上げ忘れても古いキャッシュを読まないようにするためのもの.
+ */
+class InfoCacheFingerprint {
+public:
+    template <typename... Args>
+    void operator()(const Args &...)
+    {
+        (this->add(typeid(Args).name(), sizeof(Args)), ...);
+    }
+
+    uint64_t get_value() const;
+
+private:
+    uint64_t value = 0xcbf29ce484222325ULL;
+
+    void add(std::string_view type_name, size_t size);
+};
+
+/*!
+ * @brief キャッシュに対応するゲームデータの読み書き処理
+ * @details キャッシュの読み込みに失敗した場合は clear で途中まで読み込んだデータを破棄し、解析元ファイルから読み直す.
+ * layout_fingerprint が異なるキャッシュは使わない.
+ */
+struct InfoCacheTable {
+    std::function<void(InfoCacheWriter &)> write;
+    std::function<void(InfoCacheReader &)> read;
+    std::function<void()> clear;
+    uint64_t layout_fingerprint;
+};
+
+tl::optional<std::vector<std::byte>> read_info_cache(std::string_view filename, const util::SHA256::Digest &source_digest, uint64_t layout_fingerprint);
+void write_info_cache(std::string_view filename, const util::SHA256::Digest &source_digest, uint64_t layout_fingerprint, std::span<const std::byte> payload);
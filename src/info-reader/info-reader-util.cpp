@@ -3,14 +3,40 @@
 #include "info-reader/parse-error-types.h"
 #include "main/angband-headers.h"
 #include "object-enchant/activation-info-table.h"
+#include "term/z-form.h"
 #include "util/enum-converter.h"
 #include "util/string-processor.h"
-#include "view/display-messages.h"
+#include <cstdarg>
 
 /* Help give useful error messages */
-int error_idx; /*!< データ読み込み/初期化時に汎用的にエラーコードを保存するグローバル変数 */
+thread_local int error_idx; /*!< データ読み込み/初期化時に汎用的にエラーコードを保存するグローバル変数 */
 int error_line; /*!< データ読み込み/初期化時に汎用的にエラー行数を保存するグローバル変数 */
 
+/* 解析エラーの説明 (ワーカースレッドでは表示できないので、メインスレッドで表示するまで溜めておく) */
+static thread_local std::vector<std::string> error_messages;
+
+/*!
+ * @brief ゲームデータの解析エラーの説明を追加する
+ * @param fmt 書式文字列
+ * @details 表示は take_info_error_messages() で取り出した側が行う.
+ */
+void info_error_format(const char *fmt, ...)
+{
+    va_list vp;
+    va_start(vp, fmt);
+    error_messages.push_back(vformat(fmt, vp));
+    va_end(vp);
+}
+
+/*!
+ * @brief 溜まっている解析エラーの説明を取り出す
+ * @return 追加された順の説明
+ */
+std::vector<std::string> take_info_error_messages()
+{
+    return std::exchange(error_messages, {});
+}
+
 /*!
  * @brief テキストトークンを走査してフラグを一つ得る(発動能力用) /
  * Grab one activation index flag
@@ -30,7 +56,7 @@ RandomArtActType grab_one_activation_flag(std::string_view what)
         return i2enum<RandomArtActType>(j);
     }
 
-    msg_format(_("未知の発動・フラグ '%s'。", "Unknown activation flag '%s'."), what.data());
+    info_error_format(_("未知の発動・フラグ '%s'。", "Unknown activation flag '%s'."), what.data());
     return RandomArtActType::NONE;
 }
 
@@ -9,11 +9,15 @@
 #include <tl/optional.hpp>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 /*
  * Size of memory reserved for initialization of some arrays
  */
-extern int error_idx; //!< エラーが発生したinfo ID
+extern thread_local int error_idx; //!< エラーが発生したinfo ID (ゲームデータは並列に読み込むのでスレッド毎に持つ)
+
+void info_error_format(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+std::vector<std::string> take_info_error_messages();
 
 enum class RandomArtActType : short;
 RandomArtActType grab_one_activation_flag(std::string_view what);
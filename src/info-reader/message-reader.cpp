@@ -12,7 +12,6 @@
 #include "term/gameterm.h"
 #include "util/enum-converter.h"
 #include "util/string-processor.h"
-#include "view/display-messages.h"
 #include <string>
 
 /*!
@@ -172,7 +171,7 @@ errr parse_monster_messages_info(nlohmann::json &message_data, angband_header *)
     errr err;
     err = set_mon_message(message_data);
     if (err) {
-        msg_format(_("モンスターメッセージ読込失敗。", "Failed to load monster message."));
+        info_error_format(_("モンスターメッセージ読込失敗。", "Failed to load monster message."));
         return err;
     }
 
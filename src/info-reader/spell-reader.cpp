@@ -6,7 +6,6 @@
 #include "system/spell-info-list.h"
 #include "util/enum-converter.h"
 #include "util/string-processor.h"
-#include "view/display-messages.h"
 
 /*!
  * @brief JSON Objectから呪文領域IDを取得する
@@ -47,7 +46,7 @@ static errr set_spell_data(const nlohmann::json &spell_data, std::vector<SpellIn
 
     int spell_id;
     if (auto err = info_set_integer(spell_data["spell_id"], spell_id, true, Range(0, 31))) {
-        msg_format(_("呪文ID読込失敗。ID: '%d'。", "Failed to load spell ID. ID: '%d'."), error_idx);
+        info_error_format(_("呪文ID読込失敗。ID: '%d'。", "Failed to load spell ID. ID: '%d'."), error_idx);
         return err;
     }
     auto info = SpellInfo();
@@ -55,17 +54,17 @@ static errr set_spell_data(const nlohmann::json &spell_data, std::vector<SpellIn
 
     const auto &tag_obj = spell_data["spell_tag"];
     if (!tag_obj.is_string()) {
-        msg_format(_("呪文タグ読込失敗。ID: '%d'。", "Failed to load spell tag. ID: '%d'."), error_idx);
+        info_error_format(_("呪文タグ読込失敗。ID: '%d'。", "Failed to load spell tag. ID: '%d'."), error_idx);
         return PARSE_ERROR_TOO_FEW_ARGUMENTS;
     }
     info.tag = tag_obj.get<std::string>();
 
     if (auto err = info_set_string(spell_data["name"], info.name, true)) {
-        msg_format(_("呪文名読込失敗。ID: '%d'。", "Failed to load spell name. ID: '%d'."), error_idx);
+        info_error_format(_("呪文名読込失敗。ID: '%d'。", "Failed to load spell name. ID: '%d'."), error_idx);
         return err;
     }
     if (auto err = info_set_string(spell_data["description"], info.description, true)) {
-        msg_format(_("呪文説明読込失敗。ID: '%d'。", "Failed to load spell description. ID: '%d'."), error_idx);
+        info_error_format(_("呪文説明読込失敗。ID: '%d'。", "Failed to load spell description. ID: '%d'."), error_idx);
         return err;
     }
     realm_spell_list[spell_id] = std::move(info);
@@ -111,14 +110,14 @@ errr parse_spell_info(nlohmann::json &spell_data, std::vector<std::vector<SpellI
 {
     RealmType realm_id;
     if (auto err = set_realm(spell_data, realm_id)) {
-        msg_format(_("領域名読込失敗。ID: '%d'。", "Failed to load realm name. ID: '%d'."), error_idx);
+        info_error_format(_("領域名読込失敗。ID: '%d'。", "Failed to load realm name. ID: '%d'."), error_idx);
         return err;
     }
 
     auto &realm_spell_list = spell_list[enum2i(realm_id)];
 
     if (auto err = set_book_data(spell_data, realm_spell_list)) {
-        msg_format(_("呪文詳細読込失敗。ID: '%d'。", "Failed to load spell data. ID: '%d'."), error_idx);
+        info_error_format(_("呪文詳細読込失敗。ID: '%d'。", "Failed to load spell data. ID: '%d'."), error_idx);
         return err;
     }
 
@@ -27,7 +27,7 @@ void DisplaySymbolsClipboard::reset_symbols()
     this->symbols = DEFAULT_SYMBOLS;
 }
 
-void DisplaySymbolsClipboard::set_symbol(const std::map<int, DisplaySymbol> &symbol_configs)
+void DisplaySymbolsClipboard::set_symbol(const TerrainSymbols &symbol_configs)
 {
     this->symbols = symbol_configs;
 }
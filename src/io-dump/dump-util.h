@@ -1,8 +1,8 @@
 #pragma once
 
 #include "system/angband.h"
+#include "system/terrain/terrain-definition.h"
 #include "view/display-symbol.h"
-#include <map>
 #include <string>
 #include <vector>
 
@@ -20,10 +20,10 @@ public:
     static DisplaySymbolsClipboard &get_instance();
 
     DisplaySymbol symbol;
-    std::map<int, DisplaySymbol> symbols;
+    TerrainSymbols symbols;
 
     void reset_symbols();
-    void set_symbol(const std::map<int, DisplaySymbol> &symbol_configs);
+    void set_symbol(const TerrainSymbols &symbol_configs);
 
 private:
     DisplaySymbolsClipboard();
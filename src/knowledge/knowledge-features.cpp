@@ -107,7 +107,7 @@ static void display_feature_list(int col, int row, int per_page, FEAT_IDX *feat_
 void do_cmd_knowledge_features(bool *need_redraw, bool visual_only, IDX direct_f_idx, IDX *lighting_level)
 {
     TermCenteredOffsetSetter tcos(MAIN_TERM_MIN_COLS, tl::nullopt);
-    std::map<int, DisplaySymbol> symbols;
+    TerrainSymbols symbols;
     const auto &[wid, hgt] = term_get_size();
     auto &terrains = TerrainList::get_instance();
     std::vector<FEAT_IDX> feat_idx(terrains.size());
@@ -2,6 +2,7 @@
 #include "floor/dungeon-feeling.h"
 #include "floor/floor-generator.h"
 #include "floor/floor-object.h"
+#include "floor/floor-save-cache.h"
 #include "floor/floor-save-util.h"
 #include "game-option/birth-options.h"
 #include "grid/grid.h"
@@ -266,6 +267,9 @@ bool load_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mode
 #endif
 
     FILE *old_fff = nullptr;
+    std::vector<byte> old_bytes;
+    std::span<const byte> old_data;
+    size_t old_pos = 0;
     byte old_xor_byte = 0;
     uint32_t old_v_check = 0;
     uint32_t old_x_check = 0;
@@ -274,6 +278,9 @@ bool load_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mode
     auto &system = AngbandSystem::get_instance();
     if (mode & SLF_SECOND) {
         old_fff = loading_savefile;
+        old_bytes = std::move(loading_savefile_bytes);
+        old_data = loading_savefile_data;
+        old_pos = loading_savefile_pos;
         old_xor_byte = load_xor_byte;
         old_v_check = v_check;
         old_x_check = x_check;
@@ -285,32 +292,51 @@ bool load_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mode
     const auto ext = format(".F%02d", (int)sf_ptr->savefile_id);
     floor_savefile.append(ext);
 
-    safe_setuid_grab();
-    loading_savefile = angband_fopen(floor_savefile, FileOpenMode::READ, true);
-    safe_setuid_drop();
-
-    bool is_save_successful = true;
-    if (!loading_savefile) {
-        is_save_successful = false;
+    /* メモリ上に残っていれば一時ファイルの代わりに読み込む (削除しない場合は複製せずにキャッシュ上のデータを直接読む) */
+    auto &cache = SavedFloorCache::get_instance();
+    tl::optional<std::span<const byte>> image;
+    if (mode & SLF_NO_KILL) {
+        image = cache.find(sf_ptr->savefile_id);
+    } else if (auto taken_image = cache.take(sf_ptr->savefile_id)) {
+        loading_savefile_bytes = std::move(*taken_image);
+        image = loading_savefile_bytes;
     }
 
-    if (is_save_successful) {
+    bool is_save_successful = true;
+    if (image) {
+        loading_savefile = nullptr;
+        loading_savefile_data = *image;
+        loading_savefile_pos = 0;
         is_save_successful = load_floor_aux(player_ptr, sf_ptr);
-        if (ferror(loading_savefile)) {
+    } else {
+        safe_setuid_grab();
+        loading_savefile = angband_fopen(floor_savefile, FileOpenMode::READ, true);
+        safe_setuid_drop();
+        if (!loading_savefile) {
             is_save_successful = false;
         }
 
-        angband_fclose(loading_savefile);
-        safe_setuid_grab();
-        if (!(mode & SLF_NO_KILL)) {
-            (void)fd_kill(floor_savefile);
-        }
+        if (is_save_successful) {
+            is_save_successful = read_loading_savefile() && load_floor_aux(player_ptr, sf_ptr);
+            if (ferror(loading_savefile)) {
+                is_save_successful = false;
+            }
 
-        safe_setuid_drop();
+            angband_fclose(loading_savefile);
+            safe_setuid_grab();
+            if (!(mode & SLF_NO_KILL)) {
+                (void)fd_kill(floor_savefile);
+            }
+
+            safe_setuid_drop();
+        }
     }
 
     if (mode & SLF_SECOND) {
         loading_savefile = old_fff;
+        loading_savefile_bytes = std::move(old_bytes);
+        loading_savefile_data = old_data;
+        loading_savefile_pos = old_pos;
         load_xor_byte = old_xor_byte;
         v_check = old_v_check;
         x_check = old_x_check;
@@ -3,8 +3,13 @@
 #include "locale/japanese.h"
 #include "term/gameterm.h"
 #include "term/screen-processor.h"
+#include <array>
+#include <span>
 
 FILE *loading_savefile;
+std::vector<byte> loading_savefile_bytes; // 読み込み中のファイルの全内容 (暗号化されたまま).
+std::span<const byte> loading_savefile_data; // 復号するバイト列 (loading_savefile_bytes または保存フロアのキャッシュを指す).
+size_t loading_savefile_pos = 0; // loading_savefile_data の次に読み込む位置.
 uint32_t loading_savefile_version;
 byte load_xor_byte; // Old "encryption" byte.
 uint32_t v_check = 0L; // Simple "checksum" on the actual values.
@@ -33,20 +38,69 @@ void load_note(std::string_view msg)
 }
 
 /*!
- * @brief ロードファイルポインタから1バイトを読み込む
- * @return 読み込んだバイト値
+ * @brief ロードファイルの全内容をメモリに読み込む
+ * @return 読み込みに成功したか否か
+ * @details ファイルを開いた直後に呼ぶこと. 以降の rd_* はメモリ上のバイト列を復号する.
+ */
+bool read_loading_savefile()
+{
+    constexpr size_t CHUNK_SIZE = 0x10000;
+    loading_savefile_bytes.clear();
+    loading_savefile_pos = 0;
+    while (true) {
+        const auto offset = loading_savefile_bytes.size();
+        loading_savefile_bytes.resize(offset + CHUNK_SIZE);
+        const auto read_size = fread(loading_savefile_bytes.data() + offset, 1, CHUNK_SIZE, loading_savefile);
+        loading_savefile_bytes.resize(offset + read_size);
+        if (read_size < CHUNK_SIZE) {
+            break;
+        }
+    }
+
+    loading_savefile_data = loading_savefile_bytes;
+    return !ferror(loading_savefile);
+}
+
+/*!
+ * @brief ロードファイルのバイト列をまとめて復号する
+ * @param values 復号した値の格納先 (この長さだけ読み込む)
  * @details
  * The following functions are used to load the basic building blocks
  * of savefiles.  They also maintain the "checksum" info for 2.7.0+
+ * ファイルの終端を越えた分は getc() が EOF を返した場合と同様に 0xFF を読んだものとして扱う.
  */
-byte sf_get(void)
+static void sf_get(std::span<byte> values)
 {
-    byte c = getc(loading_savefile) & 0xFF;
-    byte v = c ^ load_xor_byte;
-    load_xor_byte = c;
+    const auto available = std::min(values.size(), loading_savefile_data.size() - loading_savefile_pos);
+    const auto *encoded = loading_savefile_data.data() + loading_savefile_pos;
+    loading_savefile_pos += available;
+
+    auto xor_byte = load_xor_byte;
+    auto v_sum = v_check;
+    auto x_sum = x_check;
+    for (size_t i = 0; i < values.size(); i++) {
+        const byte c = (i < available) ? encoded[i] : 0xFF;
+        const byte v = c ^ xor_byte;
+        xor_byte = c;
+        values[i] = v;
+
+        v_sum += v;
+        x_sum += xor_byte;
+    }
 
-    v_check += v;
-    x_check += load_xor_byte;
+    load_xor_byte = xor_byte;
+    v_check = v_sum;
+    x_check = x_sum;
+}
+
+/*!
+ * @brief ロードファイルポインタから1バイトを読み込む
+ * @return 読み込んだバイト値
+ */
+byte sf_get(void)
+{
+    byte v;
+    sf_get({ &v, 1 });
     return v;
 }
 
@@ -71,10 +125,9 @@ byte rd_byte()
  */
 uint16_t rd_u16b()
 {
-    uint16_t val = sf_get();
-    val |= (static_cast<uint16_t>(sf_get()) << 8);
-
-    return val;
+    std::array<byte, 2> bytes;
+    sf_get(bytes);
+    return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
 }
 
 /*!
@@ -90,10 +143,12 @@ int16_t rd_s16b()
  */
 uint32_t rd_u32b()
 {
-    uint32_t val = sf_get();
-    val |= (static_cast<uint32_t>(sf_get()) << 8);
-    val |= (static_cast<uint32_t>(sf_get()) << 16);
-    val |= (static_cast<uint32_t>(sf_get()) << 24);
+    std::array<byte, 4> bytes;
+    sf_get(bytes);
+    uint32_t val = bytes[0];
+    val |= (static_cast<uint32_t>(bytes[1]) << 8);
+    val |= (static_cast<uint32_t>(bytes[2]) << 16);
+    val |= (static_cast<uint32_t>(bytes[3]) << 24);
 
     return val;
 }
@@ -111,9 +166,20 @@ int32_t rd_s32b()
  */
 std::string rd_string()
 {
-    std::string str;
-    str.reserve(1024);
+    /* 復号した値が0になる (暗号化された値が直前と等しくなる) 位置までを終端の前にまとめて復号する */
+    auto length = 0U;
+    auto prev = load_xor_byte;
+    for (auto pos = loading_savefile_pos; pos < loading_savefile_data.size(); pos++) {
+        if (loading_savefile_data[pos] == prev) {
+            break;
+        }
+
+        prev = loading_savefile_data[pos];
+        length++;
+    }
 
+    std::string str(length, '\0');
+    sf_get({ reinterpret_cast<byte *>(str.data()), str.size() });
     while (true) {
         const auto ch = static_cast<char>(rd_byte());
         if (ch == '\0') {
@@ -4,12 +4,17 @@
 
 #include <algorithm>
 #include <bitset>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 enum class CharacterEncoding : uint8_t;
 
 extern FILE *loading_savefile;
+extern std::vector<byte> loading_savefile_bytes;
+extern std::span<const byte> loading_savefile_data;
+extern size_t loading_savefile_pos;
 extern uint32_t loading_savefile_version;
 extern byte load_xor_byte;
 extern uint32_t v_check;
@@ -17,6 +22,7 @@ extern uint32_t x_check;
 extern CharacterEncoding loading_character_encoding;
 
 void load_note(std::string_view msg);
+bool read_loading_savefile();
 byte sf_get();
 bool rd_bool();
 byte rd_byte();
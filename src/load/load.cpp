@@ -276,6 +276,11 @@ static errr rd_savefile(PlayerType *player_ptr)
         return -1;
     }
 
+    if (!read_loading_savefile()) {
+        angband_fclose(loading_savefile);
+        return -1;
+    }
+
     try {
         auto err = exe_reading_savefile(player_ptr);
         if (ferror(loading_savefile)) {
@@ -0,0 +1,105 @@
+/*!
+ * @file main-headless.cpp
+ * @brief 画面を持たない表示モジュール
+ * @details 描画は全て捨て、キー入力は決められたキー列を繰り返し与える.
+ * ゲームターン処理のベンチマーク (--benchmark-turns) で使うことを想定している.
+ * サブオプション -k<keys> で与えるキー列を指定する (マクロと同じ書式). 省略時は "\e," (ESCと足踏み) を繰り返す.
+ */
+
+#include "io/macro-configurations-store.h"
+#include "system/angband.h"
+#include "term/gameterm.h"
+#include "term/term-color-types.h"
+#include "term/z-term.h"
+#include <string>
+#include <string_view>
+
+namespace {
+constexpr std::string_view DEFAULT_HEADLESS_KEYS = "\\e,";
+
+term_type headless_term;
+std::string headless_keys; //!< 繰り返し与えるキー列
+size_t headless_key_pos = 0;
+
+/*!
+ * @brief キー入力を待っている時だけ、キー列から次のキーを与える
+ * @details 入力を待たない問い合わせ (休憩の中断判定など) に応えると行動が中断されてしまうので、何もしない.
+ */
+errr game_term_xtra_headless_event(int v)
+{
+    if (!v || headless_keys.empty()) {
+        return 0;
+    }
+
+    const auto key = static_cast<unsigned char>(headless_keys[headless_key_pos]);
+    headless_key_pos = (headless_key_pos + 1) % headless_keys.size();
+    return term_key_push(key);
+}
+
+errr game_term_xtra_headless(int n, int v)
+{
+    switch (n) {
+    case TERM_XTRA_EVENT:
+        return game_term_xtra_headless_event(v);
+    case TERM_XTRA_FLUSH:
+    case TERM_XTRA_CLEAR:
+    case TERM_XTRA_FRESH:
+    case TERM_XTRA_SHAPE:
+    case TERM_XTRA_NOISE:
+    case TERM_XTRA_DELAY:
+    case TERM_XTRA_REACT:
+        return 0;
+    default:
+        return 1;
+    }
+}
+
+errr game_term_curs_headless(TERM_LEN, TERM_LEN)
+{
+    return 0;
+}
+
+errr game_term_wipe_headless(TERM_LEN, TERM_LEN, int)
+{
+    return 0;
+}
+
+errr game_term_text_headless(TERM_LEN, TERM_LEN, int, TERM_COLOR, concptr)
+{
+    return 0;
+}
+}
+
+/*!
+ * @brief ヘッドレス表示モジュールを初期化する
+ * @param argc サブオプションの数
+ * @param argv サブオプション
+ * @return 常に0 (成功)
+ */
+errr init_headless(int argc, char *argv[])
+{
+    auto keys = std::string(DEFAULT_HEADLESS_KEYS);
+    for (auto i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        if (arg.starts_with("-k")) {
+            keys = arg.substr(2);
+        }
+    }
+
+    char buf[1024]{};
+    text_to_ascii(buf, keys, sizeof(buf));
+    headless_keys = buf;
+
+    auto *t = &headless_term;
+    term_init(t, MAIN_TERM_MIN_COLS, MAIN_TERM_MIN_ROWS, 256);
+    t->attr_blank = TERM_WHITE;
+    t->char_blank = ' ';
+    t->xtra_hook = game_term_xtra_headless;
+    t->curs_hook = game_term_curs_headless;
+    t->wipe_hook = game_term_wipe_headless;
+    t->text_hook = game_term_text_headless;
+    term_activate(t);
+    angband_terms[0] = t;
+    term_screen = t;
+    return 0;
+}
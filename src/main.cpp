@@ -9,6 +9,9 @@
 #include "core/asking-player.h"
 #include "core/game-play.h"
 #include "core/scores.h"
+#include "core/turn-benchmark.h"
+#include "floor/floor-generation-benchmark.h"
+#include "floor/floor-save-cache.h"
 #include "game-option/runtime-arguments.h"
 #include "io/files-util.h"
 #include "io/record-play-movie.h"
@@ -28,9 +31,11 @@
 #include "view/display-scores.h"
 #include "wizard/spoiler-util.h"
 #include "wizard/wizard-spoiler.h"
+#include <cstdlib>
 #include <filesystem>
 #include <string>
 #include <string_view>
+#include <tl/optional.hpp>
 
 /*
  * Available graphic modes
@@ -181,6 +186,14 @@ static void display_usage(const char *program)
     puts("  -d<def>  Define a 'lib' dir sub-path");
     puts("  --output-spoilers");
     puts("           Output auto generated spoilers and exit");
+    puts("  --benchmark-turns=<num>");
+    puts("           Run <num> game turns of your savefile headlessly, report timings and exit");
+    puts("  --benchmark-floors=<num>");
+    puts("           Generate <num> floors on every dungeon level headlessly, report timings and exit");
+    puts("  --benchmark-seed=<num>");
+    puts("           Reseed the RNG with <num> when the benchmark starts");
+    puts("  --floor-cache=<MiB>");
+    puts("           Keep up to <MiB> of saved floors in memory (default 16, 0 writes every floor to a file)");
     puts("");
 
 #ifdef USE_X11
@@ -205,19 +218,70 @@ static void display_usage(const char *program)
     puts("  -mcap    To use CAP (\"Termcap\" calls)");
 #endif /* USE_CAP */
 
+    puts("  -mheadless To use no display (for benchmarks)");
+    puts("  --       Sub options");
+    puts("  -- -k<keys> Keys to repeat as input (default: \\e,)");
+
     /* Actually abort the process */
     quit("");
 }
 
+/*!
+ * @brief ベンチマークの設定
+ */
+struct BenchmarkArguments {
+    int turns = 0; //!< 計測するゲームターン数
+    int floors = 0; //!< 1つの階で生成するフロアの数
+    tl::optional<uint32_t> seed; //!< 計測開始時に設定する乱数のシード
+
+    bool is_enabled() const
+    {
+        return (this->turns > 0) || (this->floors > 0);
+    }
+};
+
 /*
  * @brief 2文字以上のコマンドライン引数 (オプション)を実行する
  * @param opt コマンドライン引数
+ * @param benchmark ベンチマークの設定先
  * @return Usageを表示する必要があるか否か
- * @details v3.0.0 Alpha21時点では、スポイラー出力モードの判定及び実行を行う
+ * @details スポイラー出力モードの判定及び実行と、ベンチマークの設定を行う
  */
-static bool parse_long_opt(const char *opt)
+static bool parse_long_opt(const char *opt, BenchmarkArguments &benchmark)
 {
-    if (strcmp(opt + 2, "output-spoilers") != 0) {
+    const std::string_view long_opt(opt + 2);
+    constexpr std::string_view benchmark_turns_opt = "benchmark-turns=";
+    constexpr std::string_view benchmark_floors_opt = "benchmark-floors=";
+    constexpr std::string_view benchmark_seed_opt = "benchmark-seed=";
+    constexpr std::string_view floor_cache_opt = "floor-cache=";
+    if (long_opt.starts_with(benchmark_turns_opt)) {
+        benchmark.turns = std::atoi(opt + 2 + benchmark_turns_opt.size());
+        return benchmark.turns <= 0;
+    }
+
+    if (long_opt.starts_with(benchmark_floors_opt)) {
+        benchmark.floors = std::atoi(opt + 2 + benchmark_floors_opt.size());
+        return benchmark.floors <= 0;
+    }
+
+    if (long_opt.starts_with(benchmark_seed_opt)) {
+        benchmark.seed = static_cast<uint32_t>(std::strtoul(opt + 2 + benchmark_seed_opt.size(), nullptr, 10));
+        return false;
+    }
+
+    if (long_opt.starts_with(floor_cache_opt)) {
+        const auto *value = opt + 2 + floor_cache_opt.size();
+        char *end;
+        const auto mebibytes = std::strtol(value, &end, 10);
+        if ((end == value) || (*end != '\0') || (mebibytes < 0) || (mebibytes > 4096)) {
+            return true;
+        }
+
+        SavedFloorCache::get_instance().set_memory_budget(static_cast<size_t>(mebibytes) * 1024 * 1024);
+        return false;
+    }
+
+    if (long_opt != "output-spoilers") {
         return true;
     }
 
@@ -286,6 +350,7 @@ int main(int argc, char *argv[])
 #endif /* SET_UID */
 
     auto browsing_movie = false;
+    BenchmarkArguments benchmark;
     for (auto i = 1; args && (i < argc); i++) {
         if (argv[i][0] != '-') {
             display_usage(argv[0]);
@@ -366,7 +431,7 @@ int main(int argc, char *argv[])
                 argv = argv + i;
                 args = false;
             } else {
-                is_usage_needed = parse_long_opt(argv[i]);
+                is_usage_needed = parse_long_opt(argv[i], benchmark);
             }
 
             break;
@@ -390,6 +455,26 @@ int main(int argc, char *argv[])
     process_player_name(p_ptr, true);
     quit_aux = quit_hook;
 
+    if (benchmark.is_enabled()) {
+        if (new_game || !std::filesystem::exists(savefile)) {
+            quit("The benchmark needs an existing savefile (-u<who>).");
+        }
+
+        TurnBenchmark::get_instance().configure(benchmark.turns, benchmark.seed);
+        FloorGenerationBenchmark::get_instance().configure(benchmark.floors, benchmark.seed);
+        if (mstr.empty()) {
+            mstr = "headless";
+        }
+    }
+
+    if (!done && (mstr == "headless")) {
+        extern errr init_headless(int, char **);
+        if (0 == init_headless(argc, argv)) {
+            ANGBAND_SYS = "headless";
+            done = true;
+        }
+    }
+
 #ifdef USE_X11
     if (!done && (mstr.empty() || (mstr == "x11"))) {
         extern errr init_x11(int, char **);
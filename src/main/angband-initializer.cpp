@@ -24,6 +24,7 @@
 #include "market/building-initializer.h"
 #include "system/angband-system.h"
 #include "system/dungeon/dungeon-definition.h"
+#include "system/dungeon/dungeon-list.h"
 #include "system/monrace/monrace-definition.h"
 #include "system/services/baseitem-monrace-service.h"
 #include "system/system-variables.h"
@@ -33,6 +34,9 @@
 #include "time.h"
 #include "util/angband-files.h"
 #include "world/world.h"
+#include <future>
+#include <utility>
+#include <vector>
 
 /*!
  * @brief 各データファイルを読み取るためのパスを取得する.
@@ -111,6 +115,129 @@ static void put_title()
     prt(title, row_version_info, col);
 }
 
+static std::vector<std::shared_future<void>> edit_file_stages; //!< 起動したゲームデータ読み込み処理
+
+/*!
+ * @brief ゲームデータを読み込むワーカースレッドを起動する
+ * @param func 読み込み処理
+ * @return 読み込みの完了を待つfuture
+ */
+template <typename Func>
+static std::shared_future<void> launch_edit_file_stage(Func &&func)
+{
+    auto stage = std::async(std::launch::async, std::forward<Func>(func)).share();
+    edit_file_stages.push_back(stage);
+    return stage;
+}
+
+/*!
+ * @brief 起動した全てのゲームデータ読み込み処理の終了を待つ
+ * @details 読み込み中にゲームを終了すると終了処理と競合するので、終了する前に呼ぶ.
+ */
+static void wait_all_edit_file_stages()
+{
+    for (const auto &stage : edit_file_stages) {
+        stage.wait();
+    }
+}
+
+/*!
+ * @brief ゲームデータの読み込みの完了を待つ
+ * @param stage 読み込み処理のfuture
+ * @details 解析エラーはワーカースレッドから例外として受け取り、メインスレッドで表示して終了する.
+ */
+static void wait_edit_file_stage(const std::shared_future<void> &stage)
+{
+    try {
+        stage.get();
+    } catch (const InfoParseError &e) {
+        wait_all_edit_file_stages();
+        e.report();
+    }
+}
+
+/*!
+ * @brief ゲームデータ (lib/edit) を読み込む
+ * @param init_note 進捗表示関数
+ * @details 互いに依存しないファイルはワーカースレッドで並列に解析し、依存するファイルは依存先の解析を待ってから解析する.
+ * 他のデータを書き換える後処理 (ダンジョン守護者のフラグ設定) と相互参照の検証は、全ての解析が終わってからメインスレッドで行う.
+ * ワーカースレッドはエラーを表示せず例外として返すので、進捗表示とエラーの表示はメインスレッドで従来と同じ順に行う.
+ */
+static void init_edit_files(void (*init_note)(concptr))
+{
+    const auto terrains = launch_edit_file_stage([] {
+        init_terrains_info();
+        init_feat_variables();
+    });
+    const auto monraces = launch_edit_file_stage(init_monrace_definitions);
+    const auto spells = launch_edit_file_stage(init_spell_info);
+    const auto baseitems = launch_edit_file_stage(init_baseitems_info);
+    const auto artifacts = launch_edit_file_stage(init_artifacts_info);
+    const auto egos = launch_edit_file_stage(init_egos_info);
+    const auto messages = launch_edit_file_stage([monraces] {
+        monraces.get();
+        init_monster_message_definitions();
+    });
+    const auto dungeons = launch_edit_file_stage([terrains] {
+        terrains.get();
+        init_dungeons_info();
+    });
+    const auto class_magics = launch_edit_file_stage([spells] {
+        spells.get();
+        init_class_magics_info();
+    });
+    const auto class_skills = launch_edit_file_stage(init_class_skills_info);
+    const auto wilderness = launch_edit_file_stage(init_wilderness);
+
+    init_note(_("[データの初期化中... (地形)]", "[Initializing arrays... (features)]"));
+    try {
+        terrains.get();
+    } catch (const InfoParseError &e) {
+        wait_all_edit_file_stages();
+        e.report();
+    } catch (const std::exception &e) {
+        wait_all_edit_file_stages();
+        quit_fmt("地形初期化不能: %s", e.what());
+    }
+
+    init_note(_("[データの初期化中... (アイテム)]", "[Initializing arrays... (objects)]"));
+    wait_edit_file_stage(baseitems);
+
+    init_note(_("[データの初期化中... (伝説のアイテム)]", "[Initializing arrays... (artifacts)]"));
+    wait_edit_file_stage(artifacts);
+
+    init_note(_("[データの初期化中... (名のあるアイテム)]", "[Initializing arrays... (ego-items)]"));
+    wait_edit_file_stage(egos);
+
+    init_note(_("[データの初期化中... (モンスター)]", "[Initializing arrays... (monsters)]"));
+    wait_edit_file_stage(monraces);
+    const auto error = BaseitemMonraceService::check_specific_drop_gold_flags_duplication();
+    if (error) {
+        wait_all_edit_file_stages();
+        quit(*error);
+    }
+
+    init_note(_("[データの初期化中... (メッセージ)]", "[Initializing arrays... (messages)]"));
+    wait_edit_file_stage(messages);
+
+    init_note(_("[データの初期化中... (ダンジョン)]", "[Initializing arrays... (dungeon)]"));
+    wait_edit_file_stage(dungeons);
+
+    init_note(_("[データの初期化中... (呪文情報)]", "[Initializing arrays... (magic)]"));
+    wait_edit_file_stage(spells);
+
+    init_note(_("[データの初期化中... (魔法)]", "[Initializing arrays... (magic)]"));
+    wait_edit_file_stage(class_magics);
+
+    init_note(_("[データの初期化中... (熟練度)]", "[Initializing arrays... (skill)]"));
+    wait_edit_file_stage(class_skills);
+
+    init_note(_("[配列を初期化しています... (荒野)]", "[Initializing arrays... (wilderness)]"));
+    wait_edit_file_stage(wilderness);
+
+    DungeonList::get_instance().retouch();
+}
+
 /*!
  * @brief 全ゲームデータ読み込みのメインルーチン /
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -170,47 +297,8 @@ void init_angband(PlayerType *player_ptr, bool no_term)
 
     void (*init_note)(concptr) = (no_term ? init_note_no_term : init_note_term);
 
-    init_note(_("[データの初期化中... (地形)]", "[Initializing arrays... (features)]"));
-    try {
-        init_terrains_info();
-        init_feat_variables();
-    } catch (const std::exception &e) {
-        quit_fmt("地形初期化不能: %s", e.what());
-    }
-
-    init_note(_("[データの初期化中... (アイテム)]", "[Initializing arrays... (objects)]"));
-    init_baseitems_info();
-
-    init_note(_("[データの初期化中... (伝説のアイテム)]", "[Initializing arrays... (artifacts)]"));
-    init_artifacts_info();
-
-    init_note(_("[データの初期化中... (名のあるアイテム)]", "[Initializing arrays... (ego-items)]"));
-    init_egos_info();
-
-    init_note(_("[データの初期化中... (モンスター)]", "[Initializing arrays... (monsters)]"));
-    init_monrace_definitions();
-    const auto error = BaseitemMonraceService::check_specific_drop_gold_flags_duplication();
-    if (error) {
-        quit(*error);
-    }
-
-    init_note(_("[データの初期化中... (メッセージ)]", "[Initializing arrays... (messages)]"));
-    init_monster_message_definitions();
-
-    init_note(_("[データの初期化中... (ダンジョン)]", "[Initializing arrays... (dungeon)]"));
-    init_dungeons_info();
-
-    init_note(_("[データの初期化中... (呪文情報)]", "[Initializing arrays... (magic)]"));
-    init_spell_info();
-
-    init_note(_("[データの初期化中... (魔法)]", "[Initializing arrays... (magic)]"));
-    init_class_magics_info();
-
-    init_note(_("[データの初期化中... (熟練度)]", "[Initializing arrays... (skill)]"));
-    init_class_skills_info();
-
-    init_note(_("[配列を初期化しています... (荒野)]", "[Initializing arrays... (wilderness)]"));
-    init_wilderness();
+    const auto vaults = launch_edit_file_stage(init_vaults_info);
+    init_edit_files(init_note);
 
     init_note(_("[配列を初期化しています... (街)]", "[Initializing arrays... (towns)]"));
     init_towns();
@@ -222,7 +310,8 @@ void init_angband(PlayerType *player_ptr, bool no_term)
     QuestList::get_instance().initialize();
 
     init_note(_("[データの初期化中... (宝物庫)]", "[Initializing arrays... (vaults)]"));
-    init_vaults_info();
+    wait_edit_file_stage(vaults);
+    edit_file_stages.clear();
 
     init_note(_("[データの初期化中... (その他)]", "[Initializing arrays... (other)]"));
     init_other(player_ptr);
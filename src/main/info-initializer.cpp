@@ -13,6 +13,7 @@
 #include "info-reader/feature-reader.h"
 #include "info-reader/fixed-map-parser.h"
 #include "info-reader/general-parser.h"
+#include "info-reader/info-cache-tables.h"
 #include "info-reader/info-reader-util.h"
 #include "info-reader/magic-reader.h"
 #include "info-reader/message-reader.h"
@@ -43,8 +44,11 @@
 #include "util/angband-files.h"
 #include "util/string-processor.h"
 #include "view/display-messages.h"
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <sys/stat.h>
@@ -61,6 +65,97 @@ concept HasShrinkToFit = requires(T t) {
     t.shrink_to_fit();
 };
 // clang-format on
+
+/*!
+ * @brief JSONのシリアライズ結果を文字列にせず、そのままSHA-256に流し込む出力先
+ * @details シリアライザは1文字ずつ書き込むことが多いので、小さなバッファに溜めてからハッシュ値計算に渡す.
+ */
+class SHA256OutputAdapter : public nlohmann::detail::output_adapter_protocol<char> {
+public:
+    SHA256OutputAdapter(util::SHA256 &sha256)
+        : sha256(sha256)
+    {
+    }
+
+    void write_character(char c) override
+    {
+        if (this->length == this->buffer.size()) {
+            this->flush();
+        }
+
+        this->buffer[this->length++] = c;
+    }
+
+    void write_characters(const char *s, size_t length) override
+    {
+        if (this->length + length > this->buffer.size()) {
+            this->flush();
+        }
+
+        if (length > this->buffer.size()) {
+            this->sha256.update(std::string_view(s, length));
+            return;
+        }
+
+        std::copy_n(s, length, this->buffer.begin() + this->length);
+        this->length += length;
+    }
+
+    void flush()
+    {
+        this->sha256.update(std::string_view(this->buffer.data(), this->length));
+        this->length = 0;
+    }
+
+private:
+    util::SHA256 &sha256;
+    std::array<char, 4096> buffer{};
+    size_t length = 0;
+};
+
+/*!
+ * @brief 解析したJSONのハッシュ値を計算する
+ * @param json_object 解析したJSON
+ * @return json_object.dump() のハッシュ値
+ * @details dump() の結果を一旦文字列に組み立てると巨大なコピーになるので、シリアライザの出力を直接ハッシュ値計算に渡す.
+ */
+util::SHA256::Digest calc_json_digest(const nlohmann::json &json_object)
+{
+    util::SHA256 sha256;
+    const auto adapter = std::make_shared<SHA256OutputAdapter>(sha256);
+    nlohmann::detail::serializer<nlohmann::json> serializer(adapter, ' ');
+    serializer.dump(json_object, false, false, 0);
+    adapter->flush();
+    return sha256.digest();
+}
+}
+
+/*!
+ * @brief 解析エラーを作る
+ * @param quit_message 終了時のメッセージ
+ * @param messages 終了前に表示する説明 (表示する順)
+ */
+InfoParseError::InfoParseError(const std::string &quit_message, std::vector<std::string> &&messages)
+    : std::runtime_error(quit_message)
+    , messages(std::move(messages))
+{
+}
+
+/*!
+ * @brief 解析エラーを表示してゲームを終了する
+ * @details メインスレッドから呼ぶこと.
+ */
+void InfoParseError::report() const
+{
+    for (const auto &message : this->messages) {
+        msg_print(message);
+    }
+
+    if (!this->messages.empty()) {
+        msg_erase();
+    }
+
+    quit(this->what());
 }
 
 /*!
@@ -90,7 +185,7 @@ static void init_info(std::string_view filename, angband_header &head, InfoType
     const auto path = path_build(ANGBAND_DIR_EDIT, filename);
     auto *fp = angband_fopen(path, FileOpenMode::READ);
     if (!fp) {
-        quit_fmt(_("'%s'ファイルをオープンできません。", "Cannot open '%s' file."), filename.data());
+        throw InfoParseError(format(_("'%s'ファイルをオープンできません。", "Cannot open '%s' file."), filename.data()));
     }
 
     char buf[1024]{};
@@ -99,14 +194,13 @@ static void init_info(std::string_view filename, angband_header &head, InfoType
     if (error_code != PARSE_ERROR_NONE) {
         const auto oops = (((error_code > 0) && (error_code < PARSE_ERROR_MAX)) ? err_str[error_code] : _("未知の", "unknown"));
 #ifdef JP
-        msg_format("'%s'ファイルの %d 行目にエラー。", filename.data(), error_line);
+        info_error_format("'%s'ファイルの %d 行目にエラー。", filename.data(), error_line);
 #else
-        msg_format("Error %d at line %d of '%s'.", error_code, error_line, filename.data());
+        info_error_format("Error %d at line %d of '%s'.", error_code, error_line, filename.data());
 #endif
-        msg_format(_("レコード %d は '%s' エラーがあります。", "Record %d contains a '%s' error."), error_idx, oops);
-        msg_format(_("構文 '%s'。", "Parsing '%s'."), buf);
-        msg_erase();
-        quit_fmt(_("'%s'ファイルにエラー", "Error in '%s' file."), filename.data());
+        info_error_format(_("レコード %d は '%s' エラーがあります。", "Record %d contains a '%s' error."), error_idx, oops);
+        info_error_format(_("構文 '%s'。", "Parsing '%s'."), buf);
+        throw InfoParseError(format(_("'%s'ファイルにエラー", "Error in '%s' file."), filename.data()), take_info_error_messages());
     }
 
     if constexpr (HasShrinkToFit<InfoType>) {
@@ -118,47 +212,114 @@ static void init_info(std::string_view filename, angband_header &head, InfoType
     }
 }
 
+/*!
+ * @brief 解析結果のキャッシュのキーとする、ゲームデータファイルのハッシュ値を計算する
+ * @param source ファイルの内容
+ * @return ハッシュ値
+ * @details キャッシュの有無を調べるためにJSONを解析・再シリアライズしなくて済むよう、ファイルのバイト列から直接計算する.
+ * 改行コードの違いでハッシュ値が変わらないよう、CRは除外する.
+ * ヘッダのハッシュ値 (キャラクターダンプのチェックサムに使う) はこれではなく、解析したJSONを再シリアライズしたものから計算する.
+ */
+static util::SHA256::Digest calc_source_digest(std::string_view source)
+{
+    util::SHA256 sha256;
+    while (!source.empty()) {
+        const auto pos = source.find('\r');
+        sha256.update(source.substr(0, pos));
+        if (pos == std::string_view::npos) {
+            break;
+        }
+
+        source.remove_prefix(pos + 1);
+    }
+
+    return sha256.digest();
+}
+
+/*!
+ * @brief 解析済みのゲームデータをキャッシュから読み込む
+ * @param filename ファイル名(拡張子jsonc)
+ * @param source_digest 解析元ファイルのハッシュ値
+ * @param head 処理に用いるヘッダ構造体
+ * @param cache_table キャッシュの読み書き処理
+ * @return 読み込めたらtrue、キャッシュが無いか壊れていたらfalse
+ */
+static bool load_info_cache(std::string_view filename, const util::SHA256::Digest &source_digest, angband_header &head, const InfoCacheTable &cache_table)
+{
+    const auto payload = read_info_cache(filename, source_digest, cache_table.layout_fingerprint);
+    if (!payload) {
+        return false;
+    }
+
+    InfoCacheReader reader(*payload);
+    reader(head.digest);
+    cache_table.read(reader);
+    if (reader.is_end()) {
+        return true;
+    }
+
+    head.digest = {};
+    cache_table.clear();
+    return false;
+}
+
 /*!
  * @brief 各種設定データをlib/edit/.jsoncから読み込み
  * Load data from lib/edit/.jsonc
  * @param filename ファイル名(拡張子jsonc)
  * @param head 処理に用いるヘッダ構造体
  * @param info データ保管先の構造体ポインタ
+ * @param cache_table 解析結果をキャッシュする場合はその読み書き処理
  * @note
  * Note that we let each entry have a unique "name" and "text" string,
  * even if the string happens to be empty (everyone has a unique '\0').
  */
 template <typename InfoType>
-static void init_json(std::string_view filename, std::string_view keyname, angband_header &head, InfoType &info, JSONParser parser)
+static void init_json(std::string_view filename, std::string_view keyname, angband_header &head, InfoType &info, JSONParser parser, const tl::optional<InfoCacheTable> &cache_table = tl::nullopt)
 {
     const auto path = path_build(ANGBAND_DIR_EDIT, filename);
-    std::ifstream ifs(path);
+    std::ifstream ifs(path, std::ios::binary);
 
     if (!ifs) {
-        quit_fmt(_("'%s'ファイルをオープンできません。", "Cannot open '%s' file."), filename.data());
+        throw InfoParseError(format(_("'%s'ファイルをオープンできません。", "Cannot open '%s' file."), filename.data()));
+    }
+
+    ifs.seekg(0, std::ios::end);
+    std::string source(static_cast<size_t>(ifs.tellg()), '\0');
+    ifs.seekg(0, std::ios::beg);
+    ifs.read(source.data(), source.size());
+    const auto source_digest = cache_table ? calc_source_digest(source) : util::SHA256::Digest{};
+    if (cache_table && load_info_cache(filename, source_digest, head, *cache_table)) {
+        if constexpr (HasShrinkToFit<InfoType>) {
+            info.shrink_to_fit();
+        }
+
+        return;
     }
 
-    std::istreambuf_iterator<char> ifs_iter(ifs);
-    std::istreambuf_iterator<char> ifs_end;
-    auto json_object = nlohmann::json::parse(ifs_iter, ifs_end, nullptr, true, true, true);
+    auto json_object = nlohmann::json::parse(source, nullptr, true, true, true);
 
     error_idx = -1;
 
     for (auto &element : json_object[keyname]) {
         const auto error_code = parser(element, &head);
         if (error_code != PARSE_ERROR_NONE) {
-            msg_erase();
-            quit_fmt(_("'%s'ファイルにエラー", "Error in '%s' file."), filename.data());
+            throw InfoParseError(format(_("'%s'ファイルにエラー", "Error in '%s' file."), filename.data()), take_info_error_messages());
         }
     }
 
-    util::SHA256 sha256;
-    sha256.update(json_object.dump());
-    head.digest = sha256.digest();
+    head.digest = calc_json_digest(json_object);
 
     if constexpr (HasShrinkToFit<InfoType>) {
         info.shrink_to_fit();
     }
+
+    if (cache_table) {
+        InfoCacheWriter writer;
+        writer(head.digest);
+        cache_table->write(writer);
+        write_info_cache(filename, source_digest, cache_table->layout_fingerprint, writer.get_bytes());
+    }
 }
 
 /*!
@@ -167,7 +328,7 @@ static void init_json(std::string_view filename, std::string_view keyname, angba
 void init_artifacts_info()
 {
     init_header(&artifacts_header);
-    init_json("ArtifactDefinitions.jsonc", "artifacts", artifacts_header, ArtifactList::get_instance(), parse_artifacts_info);
+    init_json("ArtifactDefinitions.jsonc", "artifacts", artifacts_header, ArtifactList::get_instance(), parse_artifacts_info, create_artifacts_cache_table());
 }
 
 /*!
@@ -176,7 +337,7 @@ void init_artifacts_info()
 void init_baseitems_info()
 {
     init_header(&baseitems_header);
-    init_json("BaseitemDefinitions.jsonc", "baseitems", baseitems_header, BaseitemList::get_instance(), parse_baseitems_info);
+    init_json("BaseitemDefinitions.jsonc", "baseitems", baseitems_header, BaseitemList::get_instance(), parse_baseitems_info, create_baseitems_cache_table());
 }
 
 /*!
@@ -200,12 +361,13 @@ void init_class_skills_info()
 }
 /*!
  * @brief ダンジョン情報読み込みのメインルーチン
+ * @details 守護者フラグの設定 (DungeonList::retouch()) はモンスター種族情報を書き換えるので、
+ * 全てのゲームデータを読み込んだ後に呼び出し元で行う.
  */
 void init_dungeons_info()
 {
     init_header(&dungeons_header);
-    auto &dungeons = DungeonList::get_instance();
-    init_info("DungeonDefinitions.txt", dungeons_header, dungeons, parse_dungeons_info, [&dungeons] { dungeons.retouch(); });
+    init_info("DungeonDefinitions.txt", dungeons_header, DungeonList::get_instance(), parse_dungeons_info);
 }
 
 /*!
@@ -234,7 +396,7 @@ void init_terrains_info()
 void init_monrace_definitions()
 {
     init_header(&monraces_header);
-    init_json("MonraceDefinitions.jsonc", "monsters", monraces_header, MonraceList::get_instance(), parse_monraces_info);
+    init_json("MonraceDefinitions.jsonc", "monsters", monraces_header, MonraceList::get_instance(), parse_monraces_info, create_monraces_cache_table());
 }
 
 /*!
@@ -316,10 +478,10 @@ void init_wilderness()
     const auto path = path_build(ANGBAND_DIR_EDIT, WILDERNESS_DEFINITION);
     std::ifstream ifs(path);
     if (!ifs) {
-        quit_fmt(_("'%s'ファイルをオープンできません。", "Cannot open '%s' file."), WILDERNESS_DEFINITION);
+        throw InfoParseError(format(_("'%s'ファイルをオープンできません。", "Cannot open '%s' file."), WILDERNESS_DEFINITION));
     }
 
     if (!read_wilderness_definition(ifs)) {
-        quit(_("荒野を初期化できません", "Cannot initialize wilderness"));
+        throw InfoParseError(_("荒野を初期化できません", "Cannot initialize wilderness"));
     }
 }
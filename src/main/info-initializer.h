@@ -4,6 +4,25 @@
  * @brief 変愚蛮怒のゲームデータ解析処理ヘッダ
  */
 
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*!
+ * @brief ゲームデータの解析エラー
+ * @details ゲームデータはワーカースレッドで解析するため、エラーの表示とゲームの終了は
+ * 例外を受け取ったメインスレッドで report() を呼んで行う.
+ */
+class InfoParseError : public std::runtime_error {
+public:
+    InfoParseError(const std::string &quit_message, std::vector<std::string> &&messages = {});
+
+    void report() const;
+
+private:
+    std::vector<std::string> messages; //!< 終了前に表示する説明
+};
+
 void init_artifacts_info();
 void init_baseitems_info();
 void init_class_magics_info();
@@ -16,6 +16,7 @@
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
 #include "util/point-2d.h"
+#include "util/trace.h"
 #include "view/display-messages.h"
 #include "world/world.h"
 #include <vector>
@@ -146,6 +147,7 @@ static void update_monster_dark(
  */
 void update_mon_lite(PlayerType *player_ptr)
 {
+    TRACE_SCOPE("update_mon_lite");
     // 座標たちを記録する配列。
     std::vector<Pos2D> points;
 
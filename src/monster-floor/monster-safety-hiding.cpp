@@ -46,11 +46,12 @@ static coordinate_candidate sweep_safe_coordinate(PlayerType *player_ptr, MONSTE
         }
 
         if (monster.mflag2.has_not(MonsterConstantFlagType::NOFLOW)) {
-            const auto dist = grid.get_distance(monrace.get_grid_flow_type());
+            const auto &flow_field = floor.get_flow_field();
+            const auto dist = flow_field.get_distance(pos, monrace.get_grid_flow_type());
             if (dist == 0) {
                 continue;
             }
-            if (dist > floor.get_grid(m_pos).get_distance(monrace.get_grid_flow_type()) + 2 * d) {
+            if (dist > flow_field.get_distance(m_pos, monrace.get_grid_flow_type()) + 2 * d) {
                 continue;
             }
         }
@@ -114,7 +114,7 @@ public:
         const auto &monster = floor.m_list[m_idx];
         const auto &monrace = monster.get_monrace();
         const auto m_pos = monster.get_position();
-        const auto no_flow = monster.mflag2.has(MonsterConstantFlagType::NOFLOW) && (floor.get_grid(m_pos).get_cost(monrace.get_grid_flow_type()) > 2);
+        const auto no_flow = monster.mflag2.has(MonsterConstantFlagType::NOFLOW) && (floor.get_flow_field().get_cost(m_pos, monrace.get_grid_flow_type()) > 2);
 
         // 単に反対側に逃げる(あまり賢くない方法)場合の移動先
         const auto pos_run_away_simple = m_pos + (m_pos - pos_move);
@@ -138,7 +138,7 @@ public:
             }
 
             const auto distance = Grid::calc_distance(pos_neighbor, *pos_safety);
-            const auto score = 5000 / (distance + 3) - 500 / (floor.get_grid(pos_neighbor).get_distance(monrace.get_grid_flow_type()) + 1);
+            const auto score = 5000 / (distance + 3) - 500 / (floor.get_flow_field().get_distance(pos_neighbor, monrace.get_grid_flow_type()) + 1);
             pos_run_away_candidates.emplace_back(score, pos_neighbor);
         }
 
@@ -300,7 +300,7 @@ public:
         }
 
         const auto gf = monrace.get_grid_flow_type();
-        int now_cost = floor.get_grid(m_pos).get_cost(gf);
+        int now_cost = floor.get_flow_field().get_cost(m_pos, gf);
         if (now_cost == 0) {
             now_cost = 999;
         }
@@ -323,8 +323,7 @@ public:
                 return tl::nullopt;
             }
 
-            const auto &grid = floor.get_grid(pos_neighbor);
-            int cost = grid.get_cost(gf);
+            int cost = floor.get_flow_field().get_cost(pos_neighbor, gf);
 
             if (!can_pass_wall && !can_kill_wall) {
                 if (cost == 0) {
@@ -361,7 +360,7 @@ private:
 };
 
 /*!
- * @brief grid.dists もしくは grid.costs を使用してプレイヤーの位置を追跡するように移動先を決定するクラス
+ * @brief FlowField の距離もしくはコストを使用してプレイヤーの位置を追跡するように移動先を決定するクラス
  */
 class NoiseTrackingMoveGridDecider : public MonsterMoveGridDecider {
 public:
@@ -387,9 +386,9 @@ public:
                 continue;
             }
 
-            const auto &grid = floor.get_grid(pos_neighbor);
+            const auto &flow_field = floor.get_flow_field();
             const auto gf = monrace.get_grid_flow_type();
-            const auto cost = monrace.behavior_flags.has_any_of({ MonsterBehaviorType::BASH_DOOR, MonsterBehaviorType::OPEN_DOOR }) ? grid.get_distance(gf) : grid.get_cost(gf);
+            const auto cost = monrace.behavior_flags.has_any_of({ MonsterBehaviorType::BASH_DOOR, MonsterBehaviorType::OPEN_DOOR }) ? flow_field.get_distance(pos_neighbor, gf) : flow_field.get_cost(pos_neighbor, gf);
             if (cost == 0 || best < cost) {
                 continue;
             }
@@ -462,9 +461,10 @@ public:
         const auto m_pos = monster.get_position();
         const auto &m_grid = floor.get_grid(m_pos);
         const auto gf = monrace.get_grid_flow_type();
-        const auto dist_to_player = m_grid.get_distance(gf); // 経由グリッド数換算(Grid::dists)による距離
+        const auto &flow_field = floor.get_flow_field();
+        const auto dist_to_player = flow_field.get_distance(m_pos, gf); // 経由グリッド数換算(FlowField::dists)による距離
         const auto distance_to_player = Grid::calc_distance(m_pos, p_pos); // Grid::calc_distance()による直線距離
-        const auto no_flow = monster.mflag2.has(MonsterConstantFlagType::NOFLOW) && (m_grid.get_cost(gf) > 2);
+        const auto no_flow = monster.mflag2.has(MonsterConstantFlagType::NOFLOW) && (flow_field.get_cost(m_pos, gf) > 2);
         const auto can_pass_wall = monrace.feature_flags.has(MonsterFeatureType::PASS_WALL) && (!monster.is_riding() || has_pass_wall(player_ptr));
         const auto can_kill_wall = monrace.feature_flags.has(MonsterFeatureType::KILL_WALL) && !monster.is_riding();
         const auto is_visible_from_player = m_grid.has_los() && projectable(floor, p_pos, m_pos);
@@ -491,9 +491,9 @@ public:
         }
 
         const auto should_go_straight = no_flow || can_pass_wall || can_kill_wall;
-        const auto try_circumventing = (distance_to_player > 1) && (monrace.freq_spell == 0) && (m_grid.get_cost(gf) <= 5);
+        const auto try_circumventing = (distance_to_player > 1) && (monrace.freq_spell == 0) && (flow_field.get_cost(m_pos, gf) <= 5);
         if (!should_go_straight && (!is_visible_from_player || try_circumventing)) {
-            if (m_grid.get_cost(gf) > 0) {
+            if (flow_field.get_cost(m_pos, gf) > 0) {
                 deciders.push_back(std::make_unique<NoiseTrackingMoveGridDecider>(player_ptr, m_idx));
             } else if (m_grid.when > 0) {
                 deciders.push_back(std::make_unique<ScentTrackingMoveGridDecider>(player_ptr, m_idx));
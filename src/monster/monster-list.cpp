@@ -30,6 +30,98 @@
 #include "world/world.h"
 #include <cmath>
 #include <iterator>
+#include <utility>
+
+/*!
+ * @brief 抽選されたモンスター種族が現在の状況で生成可能かを調べる
+ * @param monrace_id 抽選されたモンスター種族ID
+ * @param mode 生成オプション
+ * @return 生成するモンスター種族ID (撃破済の合体ユニークは分離ユニークに置き換える). 生成できないならtl::nullopt
+ */
+static tl::optional<MonraceId> filter_selectable_monrace(MonraceId monrace_id, uint32_t mode)
+{
+    if (any_bits(mode, PM_ARENA | PM_CHAMELEON)) {
+        return monrace_id;
+    }
+
+    const auto &monraces = MonraceList::get_instance();
+    if (monraces.is_unified(monrace_id) && monraces.get_monrace(monrace_id).is_dead_unique()) {
+        monrace_id = monraces.select_random_separated_unique_of(monrace_id);
+    }
+
+    const auto &monrace = monraces.get_monrace(monrace_id);
+    if (!monrace.can_generate() && none_bits(mode, PM_CLONE)) {
+        return tl::nullopt;
+    }
+
+    if (monrace.population_flags.has(MonsterPopulationType::ONLY_ONE) && monrace.has_entity()) {
+        return tl::nullopt;
+    }
+
+    if (monrace.population_flags.has(MonsterPopulationType::BUNBUN_STRIKER) && (monrace.cur_num >= MAX_BUNBUN_NUM)) {
+        return tl::nullopt;
+    }
+
+    if (!monraces.is_selectable(monrace_id)) {
+        return tl::nullopt;
+    }
+
+    return monrace_id;
+}
+
+/*!
+ * @brief キャッシュした抽選テーブルから、現在の状況で生成可能なモンスター種族を1種抽選する
+ * @param prob_table 生成階の範囲で絞り込んだ抽選テーブル
+ * @param mode 生成オプション
+ * @return 生成するモンスター種族ID. 規定回数抽選しても生成可能な種族が出なければtl::nullopt
+ * @details 生成できない種族が出たら引き直す (棄却法). 生成可能な種族だけで作ったテーブルから抽選するのと同じ確率になる.
+ */
+static tl::optional<MonraceId> pick_selectable_monrace(const ProbabilityTable<MonraceId> &prob_table, uint32_t mode)
+{
+    constexpr auto max_trials = 32;
+    for (auto i = 0; i < max_trials; i++) {
+        const auto monrace_id = filter_selectable_monrace(prob_table.pick_one_at_random(), mode);
+        if (monrace_id) {
+            return monrace_id;
+        }
+    }
+
+    return tl::nullopt;
+}
+
+/*!
+ * @brief 現在の状況で生成可能なモンスター種族のみで抽選テーブルを作る
+ * @param min_level 最小生成階
+ * @param max_level 最大生成階
+ * @param mode 生成オプション
+ * @return 抽選テーブル
+ * @details 生成できない種族が多く、棄却法で抽選できなかった場合にのみ使う.
+ */
+static ProbabilityTable<MonraceId> make_selectable_monrace_table(int min_level, int max_level, uint32_t mode)
+{
+    ProbabilityTable<MonraceId> prob_table;
+    const auto &table = MonraceAllocationTable::get_instance();
+    for (const auto &entry : table) {
+        if (entry.level < min_level) {
+            continue;
+        }
+
+        if (max_level < entry.level) {
+            break;
+        } // sorted by depth array,
+
+        if (entry.prob2 <= 0) {
+            continue;
+        }
+
+        const auto monrace_id = filter_selectable_monrace(entry.index, mode);
+        if (monrace_id) {
+            prob_table.entry_item(*monrace_id, entry.prob2);
+        }
+    }
+
+    return prob_table;
+}
 
 /*!
  * @brief 生成モンスター種族を1種生成テーブルから選択する
@@ -89,47 +181,8 @@ MonraceId get_mon_num(PlayerType *player_ptr, int min_level, int max_level, uint
         }
     }
 
-    ProbabilityTable<MonraceId> prob_table;
-
-    /* Process probabilities */
     const auto &monraces = MonraceList::get_instance();
-    const auto &table = MonraceAllocationTable::get_instance();
-    for (auto i = 0U; i < table.size(); i++) {
-        const auto &entry = table.get_entry(i);
-        if (entry.level < min_level) {
-            continue;
-        }
-        if (max_level < entry.level) {
-            break;
-        } // sorted by depth array,
-
-        auto monrace_id = entry.index;
-        if (none_bits(mode, PM_ARENA | PM_CHAMELEON)) {
-            if (monraces.is_unified(monrace_id) && monraces.get_monrace(monrace_id).is_dead_unique()) {
-                monrace_id = monraces.select_random_separated_unique_of(monrace_id);
-            }
-
-            auto &monrace = monraces.get_monrace(monrace_id);
-            if (!monrace.can_generate() && none_bits(mode, PM_CLONE)) {
-                continue;
-            }
-
-            if (monrace.population_flags.has(MonsterPopulationType::ONLY_ONE) && monrace.has_entity()) {
-                continue;
-            }
-
-            if (monrace.population_flags.has(MonsterPopulationType::BUNBUN_STRIKER) && (monrace.cur_num >= MAX_BUNBUN_NUM)) {
-                continue;
-            }
-
-            if (!monraces.is_selectable(monrace_id)) {
-                continue;
-            }
-        }
-
-        prob_table.entry_item(monrace_id, entry.prob2);
-    }
-
+    const auto &prob_table = MonraceAllocationTable::get_instance().get_selection_table(min_level, max_level);
     if (cheat_hear) {
         constexpr auto fmt = _("モンスター第3次候補数:{}({}-{}F){} ", "monster third selection:{}({}-{}F){} ");
         msg_print(fmt, prob_table.item_count(), min_level, max_level, prob_table.total_prob());
@@ -151,7 +204,25 @@ MonraceId get_mon_num(PlayerType *player_ptr, int min_level, int max_level, uint
     }
 
     std::vector<MonraceId> result;
-    ProbabilityTable<MonraceId>::lottery(std::back_inserter(result), prob_table, n);
+    for (auto i = 0; i < n; i++) {
+        const auto monrace_id = pick_selectable_monrace(prob_table, mode);
+        if (!monrace_id) {
+            break;
+        }
+
+        result.push_back(*monrace_id);
+    }
+
+    if (std::cmp_less(result.size(), n)) {
+        const auto filtered_table = make_selectable_monrace_table(min_level, max_level, mode);
+        if (filtered_table.empty()) {
+            return MonraceList::empty_id();
+        }
+
+        result.clear();
+        ProbabilityTable<MonraceId>::lottery(std::back_inserter(result), filtered_table, n);
+    }
+
     const auto it = std::max_element(result.begin(), result.end(),
         [&monraces](MonraceId id1, MonraceId id2) { return monraces.get_monrace(id1).level < monraces.get_monrace(id2).level; });
     return *it;
@@ -68,6 +68,7 @@
 #include "system/redrawing-flags-updater.h"
 #include "target/projection-path-calculator.h"
 #include "tracking/lore-tracker.h"
+#include "util/trace.h"
 #include "view/display-messages.h"
 #include "world/world.h"
 
@@ -122,6 +123,7 @@ constexpr auto STALKER_DISTANCE_THRESHOLD = 20; //!< モンスターが背後に
 void process_monster(PlayerType *player_ptr, MONSTER_IDX m_idx)
 {
     auto &monster = player_ptr->current_floor_ptr->m_list[m_idx];
+    TRACE_SCOPE_DETAIL("process_monster", monster.get_monrace().name.en_string());
     turn_flags tmp_flags;
     turn_flags *turn_flags_ptr = init_turn_flags(monster.is_riding(), &tmp_flags);
     turn_flags_ptr->see_m = is_seen(player_ptr, monster);
@@ -640,6 +642,7 @@ bool process_monster_fear(PlayerType *player_ptr, turn_flags *turn_flags_ptr, MO
  */
 void process_monsters(PlayerType *player_ptr)
 {
+    TRACE_SCOPE("process_monsters");
     const auto &tracker = LoreTracker::get_instance();
     const auto old_monrace_id = tracker.get_trackee();
     OldRaceFlags flags(old_monrace_id);
@@ -669,6 +672,8 @@ void sweep_monster_process(PlayerType *player_ptr)
         }
     }
 
+    TRACE_HISTOGRAM("monsters on floor", std::ssize(valid_m_idx_list));
+
     for (const auto m_idx : valid_m_idx_list) {
         auto &monster = floor.m_list[m_idx];
 
@@ -10,6 +10,7 @@
 #include "spell/summon-types.h"
 #include "system/angband-exceptions.h"
 #include "system/dungeon/dungeon-definition.h"
+#include "system/enums/dungeon/dungeon-id.h"
 #include "system/enums/monrace/monrace-id.h"
 #include "system/enums/terrain/wilderness-terrain.h"
 #include "system/floor/floor-info.h"
@@ -26,6 +27,8 @@
 #include "wizard/monrace-filter-debug-info.h"
 #include <algorithm>
 #include <iterator>
+#include <map>
+#include <tuple>
 
 /**
  * @brief モンスターがダンジョンに出現できる条件を満たしているかのフラグ判定関数(AND)
@@ -245,6 +248,146 @@ static bool do_hook(PlayerType *player_ptr, MonraceHook hook, MonraceId monrace_
     }
 }
 
+namespace {
+/*!
+ * @brief ダンジョンの制限 (restrict_monster_to_dungeon()) の判定種別
+ */
+enum class DungeonRestriction {
+    NORMAL,
+    SUMMON,
+    CHAMELEON,
+};
+
+/*!
+ * @brief モンスター生成テーブルの添字に対するビット集合
+ */
+class MonraceIndexBits {
+public:
+    MonraceIndexBits() = default;
+    explicit MonraceIndexBits(size_t size)
+        : words((size + 63) / 64)
+    {
+    }
+
+    bool test(size_t index) const
+    {
+        return ((this->words[index / 64] >> (index % 64)) & 1) != 0;
+    }
+
+    void set(size_t index)
+    {
+        this->words[index / 64] |= 1ULL << (index % 64);
+    }
+
+    MonraceIndexBits &operator&=(const MonraceIndexBits &other)
+    {
+        for (size_t i = 0; i < this->words.size(); i++) {
+            this->words[i] &= other.words[i];
+        }
+
+        return *this;
+    }
+
+private:
+    std::vector<uint64_t> words;
+};
+
+/*!
+ * @brief モンスター種族とフロアだけで決まる生成制約の判定結果キャッシュ
+ * @details 生成制約ごとに、モンスター生成テーブルの全項目の判定結果をビット集合として保持する.
+ * ダンジョン・地上/地下・階層のいずれかが変わったら全て破棄して計算し直す.
+ */
+class MonraceFilterCache {
+public:
+    static MonraceFilterCache &get_instance()
+    {
+        static MonraceFilterCache instance;
+        return instance;
+    }
+
+    void update(const FloorType &floor)
+    {
+        const auto size = MonraceAllocationTable::get_instance().size();
+        const auto key = std::make_tuple(floor.dungeon_id, floor.is_underground(), floor.dun_level, size);
+        if (key == this->key) {
+            return;
+        }
+
+        this->key = key;
+        this->hook_bits.clear();
+        this->terrain_bits.clear();
+        this->restriction_bits.clear();
+    }
+
+    const MonraceIndexBits &get_hook_bits(PlayerType *player_ptr, MonraceHook hook)
+    {
+        return get_bits(this->hook_bits, hook, [player_ptr, hook](MonraceId monrace_id) { return do_hook(player_ptr, hook, monrace_id); });
+    }
+
+    const MonraceIndexBits &get_terrain_bits(const FloorType &floor, MonraceHookTerrain hook)
+    {
+        return get_bits(this->terrain_bits, hook, [&floor, hook](MonraceId monrace_id) { return floor.filter_monrace_terrain(monrace_id, hook); });
+    }
+
+    const MonraceIndexBits &get_restriction_bits(const FloorType &floor, DungeonRestriction restriction)
+    {
+        const auto &dungeon = floor.get_dungeon_definition();
+        const auto has_summon_specific_type = restriction == DungeonRestriction::SUMMON;
+        const auto is_chameleon_polymorph = restriction == DungeonRestriction::CHAMELEON;
+        return get_bits(this->restriction_bits, restriction, [&](MonraceId monrace_id) {
+            return restrict_monster_to_dungeon(dungeon, floor.dun_level, monrace_id, has_summon_specific_type, is_chameleon_polymorph);
+        });
+    }
+
+    /*!
+     * @brief 生成制約がモンスター種族とフロアだけで決まるかを返す
+     * @details プレイヤーのレベルや部屋生成中の状態などを参照する制約はキャッシュできない.
+     */
+    static bool is_cacheable(MonraceHook hook)
+    {
+        switch (hook) {
+        case MonraceHook::NIGHTMARE:
+        case MonraceHook::TANUKI:
+        case MonraceHook::CLONE:
+        case MonraceHook::GOOD:
+        case MonraceHook::EVIL:
+        case MonraceHook::DRAGON:
+            return false;
+        default:
+            return true;
+        }
+    }
+
+private:
+    MonraceFilterCache() = default;
+
+    std::tuple<DungeonId, bool, int, size_t> key{};
+    std::map<MonraceHook, MonraceIndexBits> hook_bits;
+    std::map<MonraceHookTerrain, MonraceIndexBits> terrain_bits;
+    std::map<DungeonRestriction, MonraceIndexBits> restriction_bits;
+
+    template <typename K, typename F>
+    static const MonraceIndexBits &get_bits(std::map<K, MonraceIndexBits> &bits_map, K key, F filter)
+    {
+        const auto [it, is_new] = bits_map.try_emplace(key);
+        if (!is_new) {
+            return it->second;
+        }
+
+        const auto &table = MonraceAllocationTable::get_instance();
+        auto &bits = it->second;
+        bits = MonraceIndexBits(table.size());
+        for (size_t i = 0; i < table.size(); i++) {
+            if (filter(table.get_entry(i).index)) {
+                bits.set(i);
+            }
+        }
+
+        return bits;
+    }
+};
+}
+
 /*!
  * @brief モンスター生成テーブルの重み修正
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -262,19 +405,28 @@ void get_mon_num_prep_enum(PlayerType *player_ptr, MonraceHook hook1, MonraceHoo
     const auto &system = AngbandSystem::get_instance();
     auto &table = MonraceAllocationTable::get_instance();
     const auto &dungeon = floor.get_dungeon_definition();
+    auto &filter_cache = MonraceFilterCache::get_instance();
+    filter_cache.update(floor);
+    auto candidate_bits = filter_cache.get_terrain_bits(floor, hook2);
+    const auto is_cacheable_hook = MonraceFilterCache::is_cacheable(hook1);
+    if (is_cacheable_hook) {
+        candidate_bits &= filter_cache.get_hook_bits(player_ptr, hook1);
+    }
+
+    const auto in_random_quest = floor.is_in_quest() && !QuestType::is_fixed(floor.quest_number);
+    const auto is_restricted = !system.is_phase_out() && floor.is_underground() && !in_random_quest;
+    const auto &restriction_bits = filter_cache.get_restriction_bits(floor, DungeonRestriction::NORMAL);
     MonraceFilterDebugInfo mfdi;
-    for (auto &entry : table) {
+    table.reset_selection_tables();
+    for (size_t i = 0; i < table.size(); i++) {
+        auto &entry = table.get_entry(i);
         const auto monrace_id = entry.index;
         entry.prob2 = 0;
-        if (entry.prob1 <= 0) {
-            continue;
-        }
-
-        if (!do_hook(player_ptr, hook1, monrace_id)) {
+        if ((entry.prob1 <= 0) || !candidate_bits.test(i)) {
             continue;
         }
 
-        if (!floor.filter_monrace_terrain(monrace_id, hook2)) {
+        if (!is_cacheable_hook && !do_hook(player_ptr, hook1, monrace_id)) {
             continue;
         }
 
@@ -289,9 +441,7 @@ void get_mon_num_prep_enum(PlayerType *player_ptr, MonraceHook hook1, MonraceHoo
         }
 
         entry.prob2 = entry.prob1;
-        const auto in_random_quest = floor.is_in_quest() && !QuestType::is_fixed(floor.quest_number);
-        const auto cond = !system.is_phase_out() && floor.is_underground() && !in_random_quest;
-        if (cond && !restrict_monster_to_dungeon(dungeon, dungeon_level, monrace_id)) {
+        if (is_restricted && !restriction_bits.test(i)) {
             entry.update_prob2(dungeon.special_div);
         }
 
@@ -371,11 +521,19 @@ void get_mon_num_prep_escort(PlayerType *player_ptr, MonraceId escorted_monrace_
     const auto &system = AngbandSystem::get_instance();
     auto &table = MonraceAllocationTable::get_instance();
     const auto &dungeon = floor.get_dungeon_definition();
+    auto &filter_cache = MonraceFilterCache::get_instance();
+    filter_cache.update(floor);
+    const auto &terrain_bits = filter_cache.get_terrain_bits(floor, hook);
+    const auto in_random_quest = floor.is_in_quest() && !QuestType::is_fixed(floor.quest_number);
+    const auto is_restricted = !system.is_phase_out() && floor.is_underground() && !in_random_quest;
+    const auto &restriction_bits = filter_cache.get_restriction_bits(floor, DungeonRestriction::NORMAL);
     MonraceFilterDebugInfo mfdi;
-    for (auto &entry : table) {
+    table.reset_selection_tables();
+    for (size_t i = 0; i < table.size(); i++) {
+        auto &entry = table.get_entry(i);
         const auto monrace_id = entry.index;
         entry.prob2 = 0;
-        if (entry.prob1 <= 0) {
+        if ((entry.prob1 <= 0) || !terrain_bits.test(i)) {
             continue;
         }
 
@@ -383,10 +541,6 @@ void get_mon_num_prep_escort(PlayerType *player_ptr, MonraceId escorted_monrace_
             continue;
         }
 
-        if (!floor.filter_monrace_terrain(monrace_id, hook)) {
-            continue;
-        }
-
         if (!system.is_phase_out()) {
             if (!entry.is_permitted(dungeon_level)) {
                 continue;
@@ -398,9 +552,7 @@ void get_mon_num_prep_escort(PlayerType *player_ptr, MonraceId escorted_monrace_
         }
 
         entry.prob2 = entry.prob1;
-        const auto in_random_quest = floor.is_in_quest() && !QuestType::is_fixed(floor.quest_number);
-        const auto cond = !system.is_phase_out() && floor.is_underground() && !in_random_quest;
-        if (cond && !restrict_monster_to_dungeon(dungeon, dungeon_level, monrace_id)) {
+        if (is_restricted && !restriction_bits.test(i)) {
             entry.update_prob2(dungeon.special_div);
         }
 
@@ -476,11 +628,19 @@ void get_mon_num_prep_summon(PlayerType *player_ptr, const SummonCondition &cond
     const auto &system = AngbandSystem::get_instance();
     auto &table = MonraceAllocationTable::get_instance();
     const auto &dungeon = floor.get_dungeon_definition();
+    auto &filter_cache = MonraceFilterCache::get_instance();
+    filter_cache.update(floor);
+    const auto &terrain_bits = filter_cache.get_terrain_bits(floor, condition.hook);
+    const auto in_random_quest = floor.is_in_quest() && !QuestType::is_fixed(floor.quest_number);
+    const auto is_restricted = !system.is_phase_out() && floor.is_underground() && !in_random_quest;
+    const auto &restriction_bits = filter_cache.get_restriction_bits(floor, DungeonRestriction::SUMMON);
     MonraceFilterDebugInfo mfdi;
-    for (auto &entry : table) {
+    table.reset_selection_tables();
+    for (size_t i = 0; i < table.size(); i++) {
+        auto &entry = table.get_entry(i);
         const auto monrace_id = entry.index;
         entry.prob2 = 0;
-        if (entry.prob1 <= 0) {
+        if ((entry.prob1 <= 0) || !terrain_bits.test(i)) {
             continue;
         }
 
@@ -488,10 +648,6 @@ void get_mon_num_prep_summon(PlayerType *player_ptr, const SummonCondition &cond
             continue;
         }
 
-        if (!floor.filter_monrace_terrain(monrace_id, condition.hook)) {
-            continue;
-        }
-
         if (!system.is_phase_out() && (condition.type != SUMMON_GUARDIANS)) {
             if (!entry.is_permitted(dungeon_level)) {
                 continue;
@@ -503,9 +659,7 @@ void get_mon_num_prep_summon(PlayerType *player_ptr, const SummonCondition &cond
         }
 
         entry.prob2 = entry.prob1;
-        const auto in_random_quest = floor.is_in_quest() && !QuestType::is_fixed(floor.quest_number);
-        const auto cond = !system.is_phase_out() && floor.is_underground() && !in_random_quest;
-        if (cond && !restrict_monster_to_dungeon(dungeon, dungeon_level, monrace_id, true)) {
+        if (is_restricted && !restriction_bits.test(i)) {
             entry.update_prob2(dungeon.special_div);
         }
 
@@ -621,13 +775,19 @@ static bool monster_hook_chameleon(PlayerType *player_ptr, const ChameleonTransf
 void get_mon_num_prep_chameleon(PlayerType *player_ptr, const ChameleonTransformation &ct)
 {
     const auto &floor = *player_ptr->current_floor_ptr;
-    const auto dungeon_level = floor.dun_level;
     const auto &system = AngbandSystem::get_instance();
     auto &table = MonraceAllocationTable::get_instance();
     const auto &dungeon = floor.get_dungeon_definition();
     const auto hook_func = ct.is_unique ? monster_hook_chameleon_lord : monster_hook_chameleon;
+    auto &filter_cache = MonraceFilterCache::get_instance();
+    filter_cache.update(floor);
+    const auto in_random_quest = floor.is_in_quest() && !QuestType::is_fixed(floor.quest_number);
+    const auto is_restricted = !system.is_phase_out() && floor.is_underground() && !in_random_quest;
+    const auto &restriction_bits = filter_cache.get_restriction_bits(floor, DungeonRestriction::CHAMELEON);
     MonraceFilterDebugInfo mfdi;
-    for (auto &entry : table) {
+    table.reset_selection_tables();
+    for (size_t i = 0; i < table.size(); i++) {
+        auto &entry = table.get_entry(i);
         const auto monrace_id = entry.index;
         entry.prob2 = 0;
         if (entry.prob1 <= 0) {
@@ -639,9 +799,7 @@ void get_mon_num_prep_chameleon(PlayerType *player_ptr, const ChameleonTransform
         }
 
         entry.prob2 = entry.prob1;
-        const auto in_random_quest = floor.is_in_quest() && !QuestType::is_fixed(floor.quest_number);
-        const auto cond = !system.is_phase_out() && floor.is_underground() && !in_random_quest;
-        if (cond && !restrict_monster_to_dungeon(dungeon, dungeon_level, monrace_id, false, true)) {
+        if (is_restricted && !restriction_bits.test(i)) {
             entry.update_prob2(dungeon.special_div);
         }
 
@@ -665,6 +823,7 @@ void get_mon_num_prep_bounty(PlayerType *player_ptr)
     const auto &system = AngbandSystem::get_instance();
     auto &table = MonraceAllocationTable::get_instance();
     MonraceFilterDebugInfo mfdi;
+    table.reset_selection_tables();
     for (auto &entry : table) {
         entry.prob2 = 0;
         if (entry.prob1 <= 0) {
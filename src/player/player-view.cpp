@@ -6,6 +6,7 @@
 #include "system/player-type-definition.h"
 #include "system/redrawing-flags-updater.h"
 #include "util/point-2d.h"
+#include "util/trace.h"
 #include <vector>
 
 /*
@@ -98,6 +99,7 @@ static bool update_view_aux(PlayerType *player_ptr, POSITION y, POSITION x, POSI
  */
 void update_view(PlayerType *player_ptr)
 {
+    TRACE_SCOPE("update_view");
     int m, d, k;
     int se, sw, ne, nw, es, en, ws, wn;
 
@@ -1,5 +1,6 @@
 #include "room/room-generator.h"
 #include "dungeon/dungeon-flag-types.h"
+#include "floor/floor-generation-benchmark.h"
 #include "game-option/birth-options.h"
 #include "game-option/cheat-types.h"
 #include "room/door-definition.h"
@@ -30,6 +31,8 @@
  */
 static bool room_build(PlayerType *player_ptr, DungeonData *dd_ptr, RoomType typ)
 {
+    const auto is_vault = (typ == RoomType::LESSER_VAULT) || (typ == RoomType::GREATER_VAULT) || (typ == RoomType::RANDOM_VAULT) || (typ == RoomType::FIXED);
+    FloorGenerationStageTimer timer(is_vault ? FloorGenerationStage::VAULTS : FloorGenerationStage::ROOMS);
     switch (typ) {
     case RoomType::NORMAL:
         return build_type1(player_ptr, dd_ptr);
@@ -1,6 +1,7 @@
 #include "save/floor-writer.h"
 #include "core/object-compressor.h"
 #include "floor/dungeon-feeling.h"
+#include "floor/floor-save-cache.h"
 #include "floor/floor-save-util.h"
 #include "floor/floor-save.h"
 #include "grid/grid.h"
@@ -8,6 +9,7 @@
 #include "io/uid-checker.h"
 #include "load/floor-loader.h"
 #include "monster/monster-compaction.h"
+#include "save/grid-template-index.h"
 #include "save/item-writer.h"
 #include "save/monster-entity-writer.h"
 #include "save/save-util.h"
@@ -18,7 +20,9 @@
 #include "system/redrawing-flags-updater.h"
 #include "term/z-form.h"
 #include "util/angband-files.h"
+#include "view/display-messages.h"
 #include <range/v3/view.hpp>
+#include <vector>
 
 namespace {
 /*
@@ -31,31 +35,17 @@ namespace {
  * Ex: 256 will be "0xff" "0x01".
  *     515 will be "0xff" "0xff" "0x03"
  */
-std::vector<GridTemplate> generate_sorted_grid_templates(const FloorType &floor)
+GridTemplateIndex generate_sorted_grid_templates(const FloorType &floor)
 {
-    std::vector<GridTemplate> templates;
-    for (const auto &pos : floor.get_area()) {
+    const auto area = floor.get_area();
+    GridTemplateIndex index(area.height() * area.width());
+    for (const auto &pos : area) {
         const auto &grid = floor.get_grid(pos);
-        int i;
-        const int size = std::ssize(templates);
-        for (i = 0; i < size; i++) {
-            auto &gt = templates[i];
-            if (gt.matches(grid)) {
-                gt.occurrence++;
-                break;
-            }
-        }
-
-        if (i < size) {
-            continue;
-        }
-
-        templates.emplace_back(grid.info, grid.feat, grid.mimic, grid.special, static_cast<uint16_t>(1));
+        index.add(grid.info, grid.feat, grid.mimic, grid.special);
     }
 
-    std::stable_sort(templates.begin(), templates.end(),
-        [](const auto &x, const auto &y) { return x.occurrence < y.occurrence; });
-    return templates;
+    index.sort_by_occurrence();
+    return index;
 }
 }
 
@@ -85,7 +75,8 @@ void wr_saved_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr)
     wr_u16b((uint16_t)floor.height);
     wr_u16b((uint16_t)floor.width);
     wr_byte(static_cast<uint8_t>(DungeonFeeling::get_instance().get_feeling()));
-    const auto templates = generate_sorted_grid_templates(floor);
+    const auto index = generate_sorted_grid_templates(floor);
+    const auto &templates = index.get_templates();
 
     /*** Dump templates ***/
     wr_u16b(static_cast<uint16_t>(templates.size()));
@@ -98,16 +89,7 @@ void wr_saved_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr)
 
     byte count = 0;
     uint16_t prev_u16b = 0;
-    for (const auto &pos : floor.get_area()) {
-        const auto &grid = floor.get_grid(pos);
-        uint i;
-        for (i = 0; i < templates.size(); i++) {
-            if (templates[i].matches(grid)) {
-                break;
-            }
-        }
-
-        uint16_t tmp16u = (uint16_t)i;
+    for (const auto tmp16u : index.get_template_ids()) {
         if ((tmp16u == prev_u16b) && (count != MAX_UCHAR)) {
             count++;
             continue;
@@ -234,8 +216,32 @@ static bool save_floor_aux(PlayerType *player_ptr, saved_floor_type *sf_ptr)
     wr_u32b(v_stamp);
     wr_u32b(x_stamp);
 
-    return !ferror(saving_savefile) && (fflush(saving_savefile) != EOF);
+    return flush_savefile();
+}
+/*!
+ * @brief 一時ファイルへの書き出しに失敗した保存フロアを、保存されていないものとして扱う
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param saved_floor 今回保存したフロア
+ * @param failed_savefile_ids 書き出しに失敗した保存フロアのファイルID
+ * @return 今回保存したフロアが失われていなければtrue
+ * @details 今回保存したフロア自身が失われた場合の後始末は、従来の一時ファイルの書き込み失敗と同じく呼び出し元で行う.
+ */
+static bool discard_lost_floors(PlayerType *player_ptr, const saved_floor_type &saved_floor, const std::vector<int> &failed_savefile_ids)
+{
+    auto is_saved = true;
+    for (const auto savefile_id : failed_savefile_ids) {
+        msg_print(_("一時保存フロアの書き出しに失敗しました。", "Failed to write a saved floor."));
+        if (savefile_id == saved_floor.savefile_id) {
+            is_saved = false;
+            continue;
+        }
+
+        kill_saved_floor(player_ptr, &saved_floors[savefile_id]);
+    }
+
+    return is_saved;
 }
+
 /*!
  * @brief ゲームプレイ中のフロア一時保存出力処理メインルーチン / Attempt to save the temporarily saved-floor data
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -250,6 +256,11 @@ bool save_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mode
     uint32_t old_x_stamp = 0;
 
     if ((mode & SLF_SECOND) != 0) {
+        /* 書き込み中のセーブファイルのバッファは切り替える前に書き出しておく */
+        if (!flush_savefile()) {
+            return false;
+        }
+
         old_fff = saving_savefile;
         old_xor_byte = save_xor_byte;
         old_v_stamp = v_stamp;
@@ -262,31 +273,16 @@ bool save_floor(PlayerType *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mode
     safe_setuid_grab();
     fd_kill(floor_savefile);
     safe_setuid_drop();
-    saving_savefile = nullptr;
-    safe_setuid_grab();
-
-    auto fd = fd_make(floor_savefile);
-    safe_setuid_drop();
-    bool is_save_successful = false;
-    if (fd >= 0) {
-        (void)fd_close(fd);
-        safe_setuid_grab();
-        saving_savefile = angband_fopen(floor_savefile, FileOpenMode::WRITE, true);
-        safe_setuid_drop();
-        if (saving_savefile) {
-            if (save_floor_aux(player_ptr, sf_ptr)) {
-                is_save_successful = true;
-            }
 
-            if (angband_fclose(saving_savefile)) {
-                is_save_successful = false;
-            }
-        }
-
-        if (!is_save_successful) {
-            safe_setuid_grab();
-            (void)fd_kill(floor_savefile);
-            safe_setuid_drop();
+    /* 一時ファイルと同一の内容をメモリ上に作り、キャッシュに預ける (書き出しはキャッシュの上限を超えた時のみ) */
+    saving_savefile = nullptr;
+    auto is_save_successful = begin_savefile_image();
+    if (is_save_successful) {
+        is_save_successful = save_floor_aux(player_ptr, sf_ptr);
+        auto image = end_savefile_image();
+        if (is_save_successful) {
+            const auto failed_savefile_ids = SavedFloorCache::get_instance().store(sf_ptr->savefile_id, floor_savefile, std::move(image));
+            is_save_successful = discard_lost_floors(player_ptr, *sf_ptr, failed_savefile_ids);
         }
     }
 
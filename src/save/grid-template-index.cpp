@@ -0,0 +1,75 @@
+/*!
+ * @file grid-template-index.cpp
+ * @brief 保存フロアのグリッドテンプレート索引実装
+ */
+
+#include "save/grid-template-index.h"
+#include <algorithm>
+#include <numeric>
+
+size_t GridTemplateIndex::KeyHash::operator()(const Key &key) const
+{
+    auto hash = static_cast<uint64_t>(key.info);
+    hash = (hash << 16) ^ static_cast<uint16_t>(key.feat);
+    hash = (hash * 0x9E3779B97F4A7C15ULL) ^ (static_cast<uint64_t>(static_cast<uint16_t>(key.mimic)) << 16) ^ static_cast<uint16_t>(key.special);
+    return static_cast<size_t>(hash ^ (hash >> 29));
+}
+
+GridTemplateIndex::GridTemplateIndex(size_t grid_count)
+{
+    this->template_ids.reserve(grid_count);
+}
+
+/*!
+ * @brief グリッドを1つ追加し、テンプレートIDを割り当てる
+ * @details 新しい組は出現順にIDを割り当てる. 既存の組であれば出現回数を数える.
+ */
+void GridTemplateIndex::add(BIT_FLAGS info, FEAT_IDX feat, FEAT_IDX mimic, short special)
+{
+    const auto [it, is_new] = this->indices.try_emplace({ info, feat, mimic, special }, static_cast<uint16_t>(this->templates.size()));
+    if (is_new) {
+        this->templates.emplace_back(info, feat, mimic, special, static_cast<uint16_t>(1));
+    } else {
+        this->templates[it->second].occurrence++;
+    }
+
+    this->template_ids.push_back(it->second);
+}
+
+/*!
+ * @brief テンプレートを出現回数順に並べ替え、各グリッドのテンプレートIDを付け替える
+ * @details 出現回数が同じテンプレートは出現順を保つ (従来の線形探索 + stable_sort と同一の並びになる).
+ * 並べ替えた後にグリッドを追加してはならない.
+ */
+void GridTemplateIndex::sort_by_occurrence()
+{
+    std::vector<uint16_t> order(this->templates.size());
+    std::iota(order.begin(), order.end(), static_cast<uint16_t>(0));
+    std::stable_sort(order.begin(), order.end(),
+        [this](auto x, auto y) { return this->templates[x].occurrence < this->templates[y].occurrence; });
+
+    std::vector<uint16_t> new_ids(order.size());
+    std::vector<GridTemplate> sorted_templates;
+    sorted_templates.reserve(order.size());
+    for (const auto old_id : order) {
+        new_ids[old_id] = static_cast<uint16_t>(sorted_templates.size());
+        sorted_templates.push_back(this->templates[old_id]);
+    }
+
+    for (auto &id : this->template_ids) {
+        id = new_ids[id];
+    }
+
+    this->templates = std::move(sorted_templates);
+    this->indices.clear();
+}
+
+const std::vector<GridTemplate> &GridTemplateIndex::get_templates() const
+{
+    return this->templates;
+}
+
+const std::vector<uint16_t> &GridTemplateIndex::get_template_ids() const
+{
+    return this->template_ids;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+/*!
+ * @file grid-template-index.h
+ * @brief 保存フロアのグリッドテンプレート索引定義
+ */
+
+#include "grid/grid.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/*!
+ * @brief 保存フロアのグリッドテンプレート索引
+ * @details グリッドを走査順に1回だけ追加し、(info, feat, mimic, special) の組をハッシュで引いてテンプレートIDを割り当てる.
+ * 各グリッドのテンプレートIDも保持するので、ランレングス圧縮の書き込み時に改めて検索する必要はない.
+ */
+class GridTemplateIndex {
+public:
+    explicit GridTemplateIndex(size_t grid_count = 0);
+
+    void add(BIT_FLAGS info, FEAT_IDX feat, FEAT_IDX mimic, short special);
+    void sort_by_occurrence();
+    const std::vector<GridTemplate> &get_templates() const;
+    const std::vector<uint16_t> &get_template_ids() const;
+
+private:
+    struct Key {
+        BIT_FLAGS info;
+        FEAT_IDX feat;
+        FEAT_IDX mimic;
+        short special;
+
+        bool operator==(const Key &other) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    std::vector<GridTemplate> templates;
+    std::vector<uint16_t> template_ids; //!< 追加した順の各グリッドのテンプレートID
+    std::unordered_map<Key, uint16_t, KeyHash> indices;
+};
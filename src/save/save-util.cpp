@@ -1,23 +1,118 @@
 #include "save/save-util.h"
+#include <array>
+#include <span>
+#include <vector>
 
 FILE *saving_savefile; /* Current save "file" */
 byte save_xor_byte; /* Simple encryption */
 uint32_t v_stamp = 0L; /* A simple "checksum" on the actual values */
 uint32_t x_stamp = 0L; /* A simple "checksum" on the encoded bytes */
 
+namespace {
+constexpr size_t SAVEFILE_BUFFER_SIZE = 0x10000; //!< 書き込みバッファがこれを超えたらファイルへ書き出す
+std::vector<byte> savefile_buffer; //!< 暗号化済でファイルへ未書き出しのバイト列
+bool is_saving_to_memory = false; //!< ファイルへ書き出さずにバッファへ溜め続けるか否か
+}
+
+/*!
+ * @brief 書き込みバッファの内容をファイルへ書き出す
+ */
+static void write_savefile_buffer()
+{
+    if (is_saving_to_memory || (saving_savefile == nullptr) || savefile_buffer.empty()) {
+        return;
+    }
+
+    (void)fwrite(savefile_buffer.data(), 1, savefile_buffer.size(), saving_savefile);
+    savefile_buffer.clear();
+}
+
+/*!
+ * @brief バイト列を暗号化して書き込みバッファに追加する / These functions place information into a savefile
+ * @param bytes 書き込むバイト列
+ * @details 暗号化とチェックサムの計算は1バイトずつ行った場合と同一になる.
+ */
+static void sf_put(std::span<const byte> bytes)
+{
+    if (savefile_buffer.size() + bytes.size() > SAVEFILE_BUFFER_SIZE) {
+        write_savefile_buffer();
+    }
+
+    const auto offset = savefile_buffer.size();
+    savefile_buffer.resize(offset + bytes.size());
+    auto xor_byte = save_xor_byte;
+    auto v_sum = v_stamp;
+    auto x_sum = x_stamp;
+    for (size_t i = 0; i < bytes.size(); i++) {
+        /* Encode the value */
+        xor_byte ^= bytes[i];
+        savefile_buffer[offset + i] = xor_byte;
+
+        /* Maintain the checksum info */
+        v_sum += bytes[i];
+        x_sum += xor_byte;
+    }
+
+    save_xor_byte = xor_byte;
+    v_stamp = v_sum;
+    x_stamp = x_sum;
+}
+
+/*!
+ * @brief 書き込みバッファの内容を全てファイルへ書き出す
+ * @return 書き込みに成功したか否か
+ * @details 書き込み中のファイルを切り替える前、及び書き込みの最後に必ず呼ぶこと.
+ * 書き込み中のファイルが無い時は、書き出すべき内容が残っていなければ成功とする.
+ */
+bool flush_savefile()
+{
+    if (is_saving_to_memory) {
+        return true;
+    }
+
+    if (saving_savefile == nullptr) {
+        return savefile_buffer.empty();
+    }
+
+    write_savefile_buffer();
+    return !ferror(saving_savefile) && (fflush(saving_savefile) != EOF);
+}
+
+/*!
+ * @brief 書き込みバッファに残っている内容を捨てる
+ * @details 書き込みに失敗した時、残った内容が次の書き込みに混ざらないようにする.
+ */
+void discard_savefile_buffer()
+{
+    savefile_buffer.clear();
+}
+
 /*!
- * @brief 1バイトをファイルに書き込む / These functions place information into a savefile a byte at a time
- * @param v 書き込むバイト値
+ * @brief ファイルの代わりにメモリ上へ書き込みを始める
+ * @details 書き込んだ内容は end_savefile_image() で受け取る.
+ * 書き込み中のファイルのバッファに残っている内容は、呼ぶ前に flush_savefile() でそのファイルへ書き出しておくこと.
+ * @return 書き込みを始められたか否か (書き出されていない内容が残っていれば失敗)
  */
-static void sf_put(byte v)
+bool begin_savefile_image()
 {
-    /* Encode the value, write a character */
-    save_xor_byte ^= v;
-    (void)putc((int)save_xor_byte, saving_savefile);
+    if (!savefile_buffer.empty()) {
+        return false;
+    }
+
+    is_saving_to_memory = true;
+    return true;
+}
 
-    /* Maintain the checksum info */
-    v_stamp += v;
-    x_stamp += save_xor_byte;
+/*!
+ * @brief メモリ上への書き込みを終え、書き込んだ内容を返す
+ * @return ファイルに書き込んだ場合と同一のバイト列
+ */
+std::vector<byte> end_savefile_image()
+{
+    is_saving_to_memory = false;
+    auto image = std::move(savefile_buffer);
+    savefile_buffer.clear();
+    return image;
 }
 
 /*!
@@ -35,7 +130,7 @@ void wr_bool(bool v)
  */
 void wr_byte(byte v)
 {
-    sf_put(v);
+    sf_put({ &v, 1 });
 }
 
 /*!
@@ -44,8 +139,8 @@ void wr_byte(byte v)
  */
 void wr_u16b(uint16_t v)
 {
-    wr_byte((byte)(v & 0xFF));
-    wr_byte((byte)((v >> 8) & 0xFF));
+    const std::array<byte, 2> bytes{ { static_cast<byte>(v & 0xFF), static_cast<byte>((v >> 8) & 0xFF) } };
+    sf_put(bytes);
 }
 
 /*!
@@ -63,10 +158,13 @@ void wr_s16b(int16_t v)
  */
 void wr_u32b(uint32_t v)
 {
-    wr_byte((byte)(v & 0xFF));
-    wr_byte((byte)((v >> 8) & 0xFF));
-    wr_byte((byte)((v >> 16) & 0xFF));
-    wr_byte((byte)((v >> 24) & 0xFF));
+    const std::array<byte, 4> bytes{ {
+        static_cast<byte>(v & 0xFF),
+        static_cast<byte>((v >> 8) & 0xFF),
+        static_cast<byte>((v >> 16) & 0xFF),
+        static_cast<byte>((v >> 24) & 0xFF),
+    } };
+    sf_put(bytes);
 }
 
 /*!
@@ -84,8 +182,6 @@ void wr_s32b(int32_t v)
  */
 void wr_string(std::string_view sv)
 {
-    for (auto c : sv) {
-        wr_byte(c);
-    }
+    sf_put({ reinterpret_cast<const byte *>(sv.data()), sv.size() });
     wr_byte('\0');
 }
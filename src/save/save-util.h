@@ -2,12 +2,17 @@
 
 #include "system/angband.h"
 #include <string_view>
+#include <vector>
 
 extern FILE *saving_savefile;
 extern byte save_xor_byte;
 extern uint32_t v_stamp;
 extern uint32_t x_stamp;
 
+bool flush_savefile();
+void discard_savefile_buffer();
+bool begin_savefile_image();
+std::vector<byte> end_savefile_image();
 void wr_bool(bool v);
 void wr_byte(byte v);
 void wr_u16b(uint16_t v);
@@ -227,6 +227,7 @@ static bool wr_savefile_new(PlayerType *player_ptr)
 
     if (!player_ptr->is_dead) {
         if (!wr_dungeon(player_ptr)) {
+            (void)flush_savefile(); /* 失敗したセーブファイルは削除されるが、バッファは空にしておく */
             return false;
         }
 
@@ -236,7 +237,7 @@ static bool wr_savefile_new(PlayerType *player_ptr)
 
     wr_u32b(v_stamp);
     wr_u32b(x_stamp);
-    return !ferror(saving_savefile) && (fflush(saving_savefile) != EOF);
+    return flush_savefile();
 }
 
 /*!
@@ -267,6 +268,9 @@ static bool save_player_aux(PlayerType *player_ptr, const std::filesystem::path
             if (angband_fclose(saving_savefile)) {
                 is_save_successful = false;
             }
+
+            saving_savefile = nullptr;
+            discard_savefile_buffer();
         }
 
         safe_setuid_grab();
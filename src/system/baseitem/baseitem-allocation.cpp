@@ -100,6 +100,10 @@ void BaseitemAllocationTable::initialize()
             aux[x]++;
         }
     }
+
+    this->is_restricted = false;
+    this->lottery_tables.clear();
+    this->restricted_lottery_tables.clear();
 }
 
 const BaseitemAllocationEntry &BaseitemAllocationTable::get_entry(int index) const
@@ -112,17 +116,29 @@ BaseitemAllocationEntry &BaseitemAllocationTable::get_entry(int index)
     return this->entries.at(index);
 }
 
+/*!
+ * @brief ベースアイテムを抽選する
+ * @param level 生成階
+ * @param mode 生成モード (AM_GOLD と AM_FORBID_CHEST のみ参照する)
+ * @param count 抽選回数. 最も生成階の深いベースアイテムを選ぶ
+ * @return 選ばれたベースアイテムのID. 候補がなければ0
+ */
 short BaseitemAllocationTable::draw_lottery(int level, uint32_t mode, int count) const
 {
-    const auto prob_table = this->make_table(level, mode);
+    const auto &prob_table = this->get_table(level, mode);
     if (prob_table.empty()) {
         return 0;
     }
 
-    std::vector<int> result;
-    ProbabilityTable<int>::lottery(std::back_inserter(result), prob_table, count);
-    const auto it = std::max_element(result.begin(), result.end(), [this](int a, int b) { return this->order_level(a, b); });
-    return this->get_entry(*it).index;
+    auto selected = prob_table.pick_one_at_random();
+    for (auto i = 1; i < count; i++) {
+        const auto index = prob_table.pick_one_at_random();
+        if (this->order_level(selected, index)) {
+            selected = index;
+        }
+    }
+
+    return this->get_entry(selected).index;
 }
 
 bool BaseitemAllocationTable::order_level(int index1, int index2) const
@@ -139,6 +155,8 @@ bool BaseitemAllocationTable::order_level(int index1, int index2) const
  */
 void BaseitemAllocationTable::set_restriction(BaseitemRestrict restrict)
 {
+    this->is_restricted = static_cast<bool>(restrict);
+    this->restricted_lottery_tables.clear();
     for (auto &entry : this->entries) {
         if (!restrict || restrict(entry.index)) {
             entry.prob2 = entry.prob1;
@@ -153,11 +171,31 @@ void BaseitemAllocationTable::set_restriction(BaseitemRestrict restrict)
  */
 void BaseitemAllocationTable::reset_restriction()
 {
+    this->is_restricted = false;
+    this->restricted_lottery_tables.clear();
     for (auto &entry : this->entries) {
         entry.prob2 = entry.prob1;
     }
 }
 
+/*!
+ * @brief 生成階と生成モードに応じた抽選テーブルを得る
+ * @param level 生成階
+ * @param mode 生成モード
+ * @return prob2 を重みとした抽選テーブル. 同じ生成階と生成モードの種別であれば、制約が変わるまで使い回す
+ */
+const ProbabilityTable<int> &BaseitemAllocationTable::get_table(int level, uint32_t mode) const
+{
+    const auto mode_class = mode & (AM_GOLD | AM_FORBID_CHEST);
+    auto &tables = this->is_restricted ? this->restricted_lottery_tables : this->lottery_tables;
+    const auto [it, is_new] = tables.try_emplace({ level, mode_class });
+    if (is_new) {
+        it->second = this->make_table(level, mode_class);
+    }
+
+    return it->second;
+}
+
 ProbabilityTable<int> BaseitemAllocationTable::make_table(int level, uint32_t mode) const
 {
     ProbabilityTable<int> prob_table;
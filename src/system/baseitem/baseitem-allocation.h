@@ -9,6 +9,8 @@
 #include "util/abstract-vector-wrapper.h"
 #include "util/probability-table.h"
 #include <functional>
+#include <map>
+#include <utility>
 
 using BaseitemRestrict = std::function<bool(short bi_id)>;
 
@@ -60,11 +62,21 @@ private:
     static BaseitemAllocationTable instance;
     BaseitemAllocationTable() = default;
     std::vector<BaseitemAllocationEntry> entries;
+    bool is_restricted = false; //!< set_restriction() で生成制約を加えているか
+
+    /*!
+     * @brief 生成階と生成モードの種別をキーにした抽選テーブルのキャッシュ
+     * @details 制約なしのテーブルは initialize() でのみ破棄する.
+     * 制約付きのテーブルは制約ごとに異なるので、set_restriction() / reset_restriction() で破棄する.
+     */
+    mutable std::map<std::pair<int, uint32_t>, ProbabilityTable<int>> lottery_tables;
+    mutable std::map<std::pair<int, uint32_t>, ProbabilityTable<int>> restricted_lottery_tables;
 
     std::vector<BaseitemAllocationEntry> &get_inner_container() override
     {
         return this->entries;
     }
 
+    const ProbabilityTable<int> &get_table(int level, uint32_t mode) const;
     ProbabilityTable<int> make_table(int level, uint32_t mode) const;
 };
@@ -60,6 +60,16 @@ const Grid &FloorType::get_grid(const Pos2D &pos) const
     return this->grid_array[pos.y][pos.x];
 }
 
+FlowField &FloorType::get_flow_field()
+{
+    return this->flow_field;
+}
+
+const FlowField &FloorType::get_flow_field() const
+{
+    return this->flow_field;
+}
+
 Rect2D FloorType::get_area(FloorBoundary fb) const
 {
     switch (fb) {
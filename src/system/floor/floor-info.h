@@ -6,6 +6,7 @@
 #include "system/baseitem/baseitem-definition.h"
 #include "system/baseitem/baseitem-list.h"
 #include "system/enums/terrain/terrain-kind.h"
+#include "system/floor/flow-field.h"
 #include "util/point-2d.h"
 #include <array>
 #include <map>
@@ -89,6 +90,8 @@ public:
     int get_level() const;
     Grid &get_grid(const Pos2D &pos);
     const Grid &get_grid(const Pos2D &pos) const;
+    FlowField &get_flow_field();
+    const FlowField &get_flow_field() const;
     Rect2D get_area(FloorBoundary fb = FloorBoundary::OUTER_WALL_INCLUSIVE) const;
     bool is_entering_dungeon() const;
     bool is_leaving_dungeon() const;
@@ -160,6 +163,7 @@ public:
 private:
     bool entering_dungeon = false;
     bool leaving_dungeon = false;
+    FlowField flow_field; //!< モンスターがプレイヤーを追跡するための経路情報
 
     short lite_n = 0; //!< Array of grids lit by player lite
     std::array<int, LITE_MAX> lite_y{};
@@ -0,0 +1,322 @@
+/*!
+ * @brief モンスターがプレイヤーを追跡するための経路情報 (フロー) 実装
+ */
+
+#include "system/floor/flow-field.h"
+#include "floor/floor-base-definitions.h"
+#include "floor/geometry.h"
+#include "system/enums/grid-flow.h"
+#include "system/enums/terrain/terrain-characteristics.h"
+#include "system/floor/floor-info.h"
+#include "system/grid-type-definition.h"
+#include "util/enum-converter.h"
+#include <algorithm>
+
+static_assert(enum2i(GridFlow::MAX) == 2, "FlowField::GRID_FLOW_NUM must be equal to GridFlow::MAX!");
+
+namespace {
+constexpr uint8_t PASSABILITY_CLOSED_DOOR = 0x40; //!< 閉じたドアがある (通行コスト+3)
+constexpr uint8_t PASSABILITY_CHECKED = 0x80; //!< 通行可否を算出済
+constexpr uint8_t ALL_LAYERS = (1U << enum2i(GridFlow::MAX)) - 1; //!< 下位ビットは GridFlow ごとの通行可否
+
+static_assert(ALL_LAYERS < PASSABILITY_CLOSED_DOOR, "Too many GridFlow kinds to pack into the passability bits!");
+
+constexpr uint8_t to_layer(GridFlow gf)
+{
+    return static_cast<uint8_t>(1U << enum2i(gf));
+}
+
+/*!
+ * @brief 閉じたドアを除き、フローの種類ごとにグリッドへ進入できるかを判定する
+ * @param grid 判定するグリッド
+ * @param gf フローの種類
+ * @return 進入できるか否か
+ */
+bool can_flow_into(const Grid &grid, GridFlow gf)
+{
+    switch (gf) {
+    case GridFlow::CAN_FLY:
+        return grid.has(TerrainCharacteristics::MOVE) || grid.has(TerrainCharacteristics::CAN_FLY);
+    default:
+        return grid.has(TerrainCharacteristics::MOVE);
+    }
+}
+}
+
+FlowField::FlowField()
+    : passabilities(MAX_HGT * MAX_WID)
+    , queue(4096)
+{
+    for (auto &plane : this->costs) {
+        plane.assign(MAX_HGT * MAX_WID, 0);
+    }
+
+    for (auto &plane : this->dists) {
+        plane.assign(MAX_HGT * MAX_WID, 0);
+    }
+}
+
+/*!
+ * @brief 指定した起点からの探索で書き換わり得る範囲を返す
+ * @param origin 探索の起点
+ * @return 起点を中心とする (MAX_FLOW_DEPTH * 2 + 1) 四方の範囲 (フロー配列の範囲内に切り詰める)
+ */
+Rect2D FlowField::get_reach(const Pos2D &origin)
+{
+    const auto reach = Rect2D(origin, origin).resized(MAX_FLOW_DEPTH);
+    const auto y1 = std::max(reach.top_left.y, 0);
+    const auto x1 = std::max(reach.top_left.x, 0);
+    const auto y2 = std::min(reach.bottom_right.y, MAX_HGT - 1);
+    const auto x2 = std::min(reach.bottom_right.x, MAX_WID - 1);
+    return { y1, x1, y2, x2 };
+}
+
+uint8_t FlowField::get_cost(const Pos2D &pos, GridFlow gf) const
+{
+    return this->costs[enum2i(gf)][to_index(pos)];
+}
+
+uint8_t FlowField::get_distance(const Pos2D &pos, GridFlow gf) const
+{
+    return this->dists[enum2i(gf)][to_index(pos)];
+}
+
+const tl::optional<Pos2D> &FlowField::get_origin() const
+{
+    return this->origin;
+}
+
+bool FlowField::is_stale() const
+{
+    return this->stale;
+}
+
+/*!
+ * @brief プレイヤーの位置を起点に全種類のフロー情報を更新する
+ * @param floor フロアへの参照
+ * @param p_pos プレイヤーの座標
+ * @details
+ * 全ての GridFlow を1回の幅優先探索で同時に進める. キューの要素は座標と「その座標から探索を進める
+ * フローの種類」のビット集合で、各フローの種類について見ればキューへの追加順は種類ごとに探索した場合と
+ * 同一になるため結果も変わらない. 各グリッドの地形による通行可否は探索中に1度だけ算出する.
+ */
+void FlowField::update(const FloorType &floor, const Pos2D &p_pos)
+{
+    /* Erase the flow information written by the last search */
+    this->reset_reach();
+    this->origin = p_pos;
+    const auto reach = get_reach(p_pos);
+    this->reset_passabilities(reach);
+
+    std::array<int, 8> offsets{};
+    std::transform(Direction::directions_8().begin(), Direction::directions_8().end(), offsets.begin(), [](const auto &d) {
+        const auto vec = d.vec();
+        return vec.y * MAX_WID + vec.x;
+    });
+
+    const auto p_index = to_index(p_pos);
+    size_t head = 0;
+    size_t tail = 0;
+    this->push(tail, head, { p_index, ALL_LAYERS });
+    while (head != tail) {
+        const auto node = this->queue[head++ & (this->queue.size() - 1)];
+        for (const auto offset : offsets) {
+            const auto index = node.index + offset;
+
+            /* Ignore player's grid */
+            if (index == p_index) {
+                continue;
+            }
+
+            const auto passability = this->get_passability(floor, index);
+            uint8_t layers_next = 0;
+            for (auto gf_index = 0; gf_index < GRID_FLOW_NUM; gf_index++) {
+                const auto layer = to_layer(i2enum<GridFlow>(gf_index));
+                if ((node.layers & layer) == 0) {
+                    continue;
+                }
+
+                auto &costs_plane = this->costs[gf_index];
+                auto &dists_plane = this->dists[gf_index];
+                uint8_t m = costs_plane[node.index] + 1;
+                const uint8_t n = dists_plane[node.index] + 1;
+                if (passability & PASSABILITY_CLOSED_DOOR) {
+                    m += 3;
+                }
+
+                /* Ignore "pre-stamped" entries */
+                auto &cost_neighbor = costs_plane[index];
+                auto &dist_neighbor = dists_plane[index];
+                if ((dist_neighbor != 0) && (dist_neighbor <= n) && (cost_neighbor <= m)) {
+                    continue;
+                }
+
+                /* Ignore "walls", "holes" and "rubble" */
+                if ((passability & layer) == 0) {
+                    continue;
+                }
+
+                /* Save the flow cost */
+                if (cost_neighbor == 0 || (cost_neighbor > m)) {
+                    cost_neighbor = m;
+                }
+                if (dist_neighbor == 0 || (dist_neighbor > n)) {
+                    dist_neighbor = n;
+                }
+
+                if (n == MAX_FLOW_DEPTH) {
+                    continue;
+                }
+
+                layers_next |= layer;
+            }
+
+            if (layers_next != 0) {
+                this->push(tail, head, { index, layers_next });
+            }
+        }
+    }
+}
+
+/*!
+ * @brief 全てのフロー情報を消去する
+ */
+void FlowField::reset()
+{
+    for (auto &plane : this->costs) {
+        std::fill(plane.begin(), plane.end(), 0);
+    }
+
+    for (auto &plane : this->dists) {
+        std::fill(plane.begin(), plane.end(), 0);
+    }
+
+    this->origin = tl::nullopt;
+    this->stale = false;
+}
+
+/*!
+ * @brief 地形の変化を通知する
+ * @param pos 地形が変化した座標
+ * @details 現在のフロー情報の探索範囲内であれば、次回の update_flow() で必ず再探索させる.
+ */
+void FlowField::notice_terrain_change(const Pos2D &pos)
+{
+    if (!this->origin) {
+        return;
+    }
+
+    const auto reach = get_reach(*this->origin);
+    auto is_in_reach = (pos.y >= reach.top_left.y) && (pos.y <= reach.bottom_right.y);
+    is_in_reach &= (pos.x >= reach.top_left.x) && (pos.x <= reach.bottom_right.x);
+    this->stale |= is_in_reach;
+}
+
+int FlowField::to_index(const Pos2D &pos)
+{
+    return pos.y * MAX_WID + pos.x;
+}
+
+Pos2D FlowField::to_position(int index)
+{
+    return { index / MAX_WID, index % MAX_WID };
+}
+
+/*!
+ * @brief グリッドの通行可否をビット集合として算出する
+ * @param floor フロアへの参照
+ * @param pos 算出する座標
+ * @return GridFlow ごとの進入可否と閉じたドアの有無
+ */
+uint8_t FlowField::calc_passability(const FloorType &floor, const Pos2D &pos)
+{
+    const auto &grid = floor.get_grid(pos);
+    const auto has_closed_door = floor.has_closed_door_at(pos);
+    auto passability = PASSABILITY_CHECKED;
+    if (has_closed_door) {
+        passability |= PASSABILITY_CLOSED_DOOR;
+    }
+
+    for (auto gf_index = 0; gf_index < GRID_FLOW_NUM; gf_index++) {
+        const auto gf = i2enum<GridFlow>(gf_index);
+        if (has_closed_door || can_flow_into(grid, gf)) {
+            passability |= to_layer(gf);
+        }
+    }
+
+    return passability;
+}
+
+/*!
+ * @brief 前回の探索で書き込まれ得る範囲のフロー情報だけを消去する
+ * @details 探索は起点から MAX_FLOW_DEPTH 歩で打ち切られるため、範囲外は常に0のままである.
+ * 起点が無い (一度も探索していない) 場合はフロア全体を消去する.
+ */
+void FlowField::reset_reach()
+{
+    if (!this->origin) {
+        this->reset();
+        return;
+    }
+
+    const auto reach = get_reach(*this->origin);
+    for (auto y = reach.top_left.y; y <= reach.bottom_right.y; y++) {
+        const auto begin = to_index({ y, reach.top_left.x });
+        const auto end = to_index({ y, reach.bottom_right.x }) + 1;
+        for (auto &plane : this->costs) {
+            std::fill(plane.begin() + begin, plane.begin() + end, 0);
+        }
+
+        for (auto &plane : this->dists) {
+            std::fill(plane.begin() + begin, plane.begin() + end, 0);
+        }
+    }
+
+    this->origin = tl::nullopt;
+    this->stale = false;
+}
+
+/*!
+ * @brief 探索範囲の通行可否を未算出に戻す
+ * @param reach 探索範囲
+ * @details 探索中に地形が変わることはないが、前回の探索以降に変わっている可能性があるため毎回消去する.
+ */
+void FlowField::reset_passabilities(const Rect2D &reach)
+{
+    for (auto y = reach.top_left.y; y <= reach.bottom_right.y; y++) {
+        const auto begin = this->passabilities.begin() + to_index({ y, reach.top_left.x });
+        std::fill(begin, begin + reach.width(), 0);
+    }
+}
+
+uint8_t FlowField::get_passability(const FloorType &floor, int index)
+{
+    auto &passability = this->passabilities[index];
+    if (passability == 0) {
+        passability = calc_passability(floor, to_position(index));
+    }
+
+    return passability;
+}
+
+/*!
+ * @brief 幅優先探索のリングバッファに要素を追加する
+ * @param tail 末尾の位置 (単調増加するカウンタ)
+ * @param head 先頭の位置 (単調増加するカウンタ)
+ * @param node 追加する要素
+ * @details 満杯の場合は容量を倍にしてから追加する. 確保したバッファは次回以降の探索でも再利用する.
+ */
+void FlowField::push(size_t &tail, size_t head, const FlowNode &node)
+{
+    const auto capacity = this->queue.size();
+    if (tail - head == capacity) {
+        std::vector<FlowNode> expanded(capacity * 2);
+        for (auto i = head; i != tail; i++) {
+            expanded[i & (expanded.size() - 1)] = this->queue[i & (capacity - 1)];
+        }
+
+        this->queue = std::move(expanded);
+    }
+
+    this->queue[tail++ & (this->queue.size() - 1)] = node;
+}
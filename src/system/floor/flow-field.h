@@ -0,0 +1,56 @@
+/*!
+ * @brief モンスターがプレイヤーを追跡するための経路情報 (フロー) 定義
+ * @details GridFlow の種類ごとに、フロア全体のコスト/距離を連続した1枚の配列 (プレーン) として保持する.
+ */
+
+#pragma once
+
+#include "util/point-2d.h"
+#include <array>
+#include <cstdint>
+#include <tl/optional.hpp>
+#include <vector>
+
+enum class GridFlow : int;
+class FloorType;
+class FlowField {
+public:
+    FlowField();
+
+    static constexpr auto MAX_FLOW_DEPTH = 32; //!< 敵のプレイヤーに対する移動道のりの最大値(この値以上は探索を打ち切る).
+
+    static Rect2D get_reach(const Pos2D &origin);
+
+    uint8_t get_cost(const Pos2D &pos, GridFlow gf) const;
+    uint8_t get_distance(const Pos2D &pos, GridFlow gf) const;
+    const tl::optional<Pos2D> &get_origin() const;
+    bool is_stale() const;
+    void update(const FloorType &floor, const Pos2D &p_pos);
+    void reset();
+    void notice_terrain_change(const Pos2D &pos);
+
+private:
+    static constexpr auto GRID_FLOW_NUM = 2; //!< GridFlow::MAX と同値.
+
+    //! 幅優先探索のキューの要素. 座標と、その座標から探索を進めるフローの種類 (ビット集合) を持つ.
+    struct FlowNode {
+        int index;
+        uint8_t layers;
+    };
+
+    std::array<std::vector<uint8_t>, GRID_FLOW_NUM> costs; //!< Cost of flowing
+    std::array<std::vector<uint8_t>, GRID_FLOW_NUM> dists; //!< Distance from player
+    std::vector<uint8_t> passabilities; //!< 探索中に算出した各グリッドの通行可否 (ビット集合)
+    std::vector<FlowNode> queue; //!< 幅優先探索用のリングバッファ (容量は2のべき乗)
+    tl::optional<Pos2D> origin; //!< 現在のフロー情報の探索起点 (最後に探索した時のプレイヤー位置)
+    bool stale = false; //!< 探索範囲内の地形が探索後に変化したか否か
+
+    static int to_index(const Pos2D &pos);
+    static Pos2D to_position(int index);
+    static uint8_t calc_passability(const FloorType &floor, const Pos2D &pos);
+
+    void reset_reach();
+    void reset_passabilities(const Rect2D &reach);
+    uint8_t get_passability(const FloorType &floor, int index);
+    void push(size_t &tail, size_t head, const FlowNode &node);
+};
@@ -2,7 +2,6 @@
 #include "monster/monster-util.h"
 #include "room/door-definition.h"
 #include "system/angband-system.h"
-#include "system/enums/grid-flow.h"
 #include "system/enums/terrain/terrain-tag.h"
 #include "system/terrain/terrain-definition.h"
 #include "system/terrain/terrain-list.h"
@@ -10,14 +9,6 @@
 #include "util/enum-converter.h"
 #include "world/world.h"
 
-Grid::Grid()
-{
-    for (const auto gf : GRID_FLOW_RANGE) {
-        this->costs[gf] = 0;
-        this->dists[gf] = 0;
-    }
-}
-
 /*!
  * @brief 2点間の距離をニュートン・ラプソン法で算出する / Distance between two points via Newton-Raphson technique
  * @param pos1 1点目の座標
@@ -188,16 +179,6 @@ bool Grid::has_monster() const
     return is_monster(this->m_idx);
 }
 
-uint8_t Grid::get_cost(GridFlow gf) const
-{
-    return this->costs.at(gf);
-}
-
-uint8_t Grid::get_distance(GridFlow gf) const
-{
-    return this->dists.at(gf);
-}
-
 bool Grid::has(TerrainCharacteristics tc) const
 {
     return this->get_terrain().has(tc);
@@ -259,20 +240,6 @@ bool Grid::can_generate_monster() const
     return is_empty_grid;
 }
 
-void Grid::reset_costs()
-{
-    for (const auto gf : GRID_FLOW_RANGE) {
-        this->costs[gf] = 0;
-    }
-}
-
-void Grid::reset_dists()
-{
-    for (const auto gf : GRID_FLOW_RANGE) {
-        this->dists[gf] = 0;
-    }
-}
-
 bool Grid::has_los() const
 {
     return any_bits(this->info, CAVE_VIEW) || AngbandSystem::get_instance().is_phase_out();
@@ -4,7 +4,6 @@
 #include "system/angband.h"
 #include "system/enums/terrain/terrain-kind.h"
 #include "util/point-2d.h"
-#include <map>
 
 /*
  * 特殊なマス状態フラグ / Special grid flags
@@ -41,13 +40,12 @@
 
 // clang-format on
 
-enum class GridFlow : int;
 enum class TerrainCharacteristics;
 enum class TerrainTag;
 class TerrainType;
 class Grid {
 public:
-    Grid();
+    Grid() = default;
     BIT_FLAGS info{}; /* Hack -- grid flags */
 
     FEAT_IDX feat{}; /* Hack -- feature type */
@@ -63,8 +61,6 @@ public:
 
     FEAT_IDX mimic{}; /* Feature to mimic */
 
-    std::map<GridFlow, uint8_t> costs; //!< Cost of flowing
-    std::map<GridFlow, uint8_t> dists; //!< Distance from player
     byte when{}; /* Hack -- when cost was computed */
 
     static int calc_distance(const Pos2D &pos1, const Pos2D &pos2);
@@ -91,8 +87,6 @@ public:
     bool is_hidden_door() const;
     bool is_acceptable_target() const;
     bool has_monster() const;
-    uint8_t get_cost(GridFlow gf) const;
-    uint8_t get_distance(GridFlow gf) const;
     bool has(TerrainCharacteristics tc) const;
     bool is_symbol(const int ch) const;
     bool is_darkened() const;
@@ -102,8 +96,6 @@ public:
     bool has_special_terrain() const;
     bool can_block_disintegration() const;
     bool can_generate_monster() const;
-    void reset_costs();
-    void reset_dists();
     bool has_los() const;
     bool has_los_terrain(TerrainKind tk = TerrainKind::NORMAL) const;
     TerrainType &get_terrain(TerrainKind tk = TerrainKind::NORMAL);
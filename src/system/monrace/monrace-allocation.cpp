@@ -88,6 +88,7 @@ void MonraceAllocationTable::initialize()
     }
 
     ranges::stable_sort(this->entries, {}, &MonraceAllocationEntry::level);
+    this->reset_selection_tables();
 }
 
 const MonraceAllocationEntry &MonraceAllocationTable::get_entry(int index) const
@@ -99,3 +100,39 @@ MonraceAllocationEntry &MonraceAllocationTable::get_entry(int index)
 {
     return this->entries.at(index);
 }
+
+/*!
+ * @brief 生成階の範囲に含まれるモンスター種族の抽選テーブルを得る
+ * @param min_level 最小生成階
+ * @param max_level 最大生成階
+ * @return prob2 を重みとした抽選テーブル
+ * @details prob2 のみから決まるので、次に reset_selection_tables() を呼ぶまで同じ範囲のテーブルを使い回す.
+ * ユニークの死亡や現在数などの状態による絞り込みは呼び出し側で抽選後に行うこと.
+ */
+const ProbabilityTable<MonraceId> &MonraceAllocationTable::get_selection_table(int min_level, int max_level) const
+{
+    const auto [it, is_new] = this->selection_tables.try_emplace({ min_level, max_level });
+    if (!is_new) {
+        return it->second;
+    }
+
+    auto &prob_table = it->second;
+    for (const auto &entry : this->entries) {
+        if (entry.level < min_level) {
+            continue;
+        }
+
+        if (max_level < entry.level) {
+            break;
+        }
+
+        prob_table.entry_item(entry.index, entry.prob2);
+    }
+
+    return prob_table;
+}
+
+void MonraceAllocationTable::reset_selection_tables()
+{
+    this->selection_tables.clear();
+}
@@ -7,6 +7,9 @@
 #pragma once
 
 #include "util/abstract-vector-wrapper.h"
+#include "util/probability-table.h"
+#include <map>
+#include <utility>
 #include <vector>
 
 enum class MonraceId : short;
@@ -39,12 +42,20 @@ public:
     void initialize();
     const MonraceAllocationEntry &get_entry(int index) const;
     MonraceAllocationEntry &get_entry(int index);
+    const ProbabilityTable<MonraceId> &get_selection_table(int min_level, int max_level) const;
+    void reset_selection_tables();
 
 private:
     static MonraceAllocationTable instance;
     MonraceAllocationTable() = default;
     std::vector<MonraceAllocationEntry> entries{};
 
+    /*!
+     * @brief 生成階の範囲をキーにした抽選テーブルのキャッシュ
+     * @details prob2 を書き換えたら (get_mon_num_prep_*() を呼んだら) reset_selection_tables() で破棄すること.
+     */
+    mutable std::map<std::pair<int, int>, ProbabilityTable<MonraceId>> selection_tables;
+
     std::vector<MonraceAllocationEntry> &get_inner_container() override
     {
         return this->entries;
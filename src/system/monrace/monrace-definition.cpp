@@ -57,6 +57,11 @@ MonraceId Reinforce::get_monrace_id() const
     return this->monrace_id;
 }
 
+const Dice &Reinforce::get_dice() const
+{
+    return this->dice;
+}
+
 bool Reinforce::is_valid() const
 {
     return MonraceList::is_valid(this->monrace_id) && this->dice.is_valid();
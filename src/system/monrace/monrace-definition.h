@@ -64,6 +64,7 @@ class Reinforce {
 public:
     Reinforce(MonraceId monrace_id, Dice dice);
     MonraceId get_monrace_id() const;
+    const Dice &get_dice() const;
     bool is_valid() const;
     const MonraceDefinition &get_monrace() const;
     std::string get_dice_as_string() const;
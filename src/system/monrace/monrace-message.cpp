@@ -28,11 +28,26 @@ bool MonsterMessage::start_with_monname() const
     return this->use_name;
 }
 
+int MonsterMessage::get_chance() const
+{
+    return this->chance;
+}
+
+std::string_view MonsterMessage::get_message_text() const
+{
+    return this->message;
+}
+
 void MonsterMessageList::emplace(const int chance, bool use_name, std::string_view message_str)
 {
     this->messages.emplace_back(chance, use_name, message_str);
 }
 
+const std::vector<MonsterMessage> &MonsterMessageList::get_messages() const
+{
+    return this->messages;
+}
+
 tl::optional<const MonsterMessage &> MonsterMessageList::get_message_obj() const
 {
     if (this->messages.empty()) {
@@ -63,6 +78,11 @@ bool MonraceMessage::has_message(MonsterMessageType message_type) const
     return this->messages.contains(message_type);
 }
 
+const std::map<MonsterMessageType, MonsterMessageList> &MonraceMessage::get_messages() const
+{
+    return this->messages;
+}
+
 MonraceMessageList MonraceMessageList::instance{};
 
 MonraceMessageList &MonraceMessageList::get_instance()
@@ -119,3 +139,14 @@ void MonraceMessageList::emplace_default(const MonsterMessageType message_type,
 {
     this->default_messages.emplace(message_type, chance, use_name, message_str);
 }
+
+const std::map<int, MonraceMessage> &MonraceMessageList::get_messages() const
+{
+    return this->messages;
+}
+
+void MonraceMessageList::clear()
+{
+    this->messages.clear();
+    this->default_messages = {};
+}
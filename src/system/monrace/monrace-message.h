@@ -12,6 +12,8 @@ public:
     MonsterMessage(int chance, bool use_name, std::string_view message);
     tl::optional<std::string_view> get_message() const;
     bool start_with_monname() const;
+    int get_chance() const;
+    std::string_view get_message_text() const;
 
 private:
     int chance;
@@ -23,6 +25,7 @@ class MonsterMessageList {
 public:
     tl::optional<const MonsterMessage &> get_message_obj() const;
     void emplace(const int chance, bool use_name, std::string_view message_str);
+    const std::vector<MonsterMessage> &get_messages() const;
 
 private:
     std::vector<MonsterMessage> messages;
@@ -33,6 +36,7 @@ public:
     tl::optional<const MonsterMessage &> get_message_obj(MonsterMessageType message_type) const;
     bool has_message(MonsterMessageType message_type) const;
     void emplace(const MonsterMessageType message_type, const int chance, bool use_name, std::string_view message_str);
+    const std::map<MonsterMessageType, MonsterMessageList> &get_messages() const;
 
 private:
     std::map<MonsterMessageType, MonsterMessageList> messages;
@@ -50,6 +54,8 @@ public:
     tl::optional<std::string> get_message(const int monrace_id, std::string_view monrace_name, const MonsterMessageType message_type);
     void emplace(const int monrace_id, const MonsterMessageType message_type, const int chance, bool use_name, std::string_view message_str);
     void emplace_default(const MonsterMessageType message_type, const int chance, bool use_name, std::string_view message_str);
+    const std::map<int, MonraceMessage> &get_messages() const;
+    void clear();
 
 private:
     MonraceMessageList() = default;
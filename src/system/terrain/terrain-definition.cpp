@@ -85,7 +85,7 @@ void TerrainType::reset_lighting(bool is_config)
     this->reset_lighting_graphics(symbols);
 }
 
-void TerrainType::reset_lighting_ascii(std::map<int, DisplaySymbol> &symbols)
+void TerrainType::reset_lighting_ascii(TerrainSymbols &symbols)
 {
     const auto color_standard = symbols[F_LIT_STANDARD].color;
     const auto character_standard = symbols[F_LIT_STANDARD].character;
@@ -96,7 +96,7 @@ void TerrainType::reset_lighting_ascii(std::map<int, DisplaySymbol> &symbols)
     }
 }
 
-void TerrainType::reset_lighting_graphics(std::map<int, DisplaySymbol> &symbols)
+void TerrainType::reset_lighting_graphics(TerrainSymbols &symbols)
 {
     const auto color_standard = symbols[F_LIT_STANDARD].color;
     const auto character_standard = symbols[F_LIT_STANDARD].character;
@@ -4,7 +4,7 @@
 #include "system/enums/terrain/terrain-characteristics.h"
 #include "util/flag-group.h"
 #include "view/display-symbol.h"
-#include <map>
+#include <array>
 
 /* Number of feats we change to (Excluding default). Used in TerrainDefinitions.txt. */
 constexpr auto MAX_FEAT_STATES = 8;
@@ -16,7 +16,8 @@ constexpr auto F_LIT_DARK = 2; /* Darkened */
 constexpr auto F_LIT_MAX = 3;
 constexpr auto F_LIT_NS_BEGIN = 1; /* Nonstandard */
 
-const std::map<int, DisplaySymbol> DEFAULT_SYMBOLS = { { F_LIT_STANDARD, {} }, { F_LIT_LITE, {} }, { F_LIT_DARK, {} } };
+using TerrainSymbols = std::array<DisplaySymbol, F_LIT_MAX>; //!< ライティング状況ごとの地形シンボル
+constexpr TerrainSymbols DEFAULT_SYMBOLS{};
 
 enum class TerrainAction {
     DESTROY = 1,
@@ -62,8 +63,8 @@ public:
     TerrainState state[MAX_FEAT_STATES]{}; /*!< TerrainState テーブル */
     FEAT_SUBTYPE subtype{}; /*!< 副特性値 */
     FEAT_POWER power{}; /*!< 地形強度 */
-    std::map<int, DisplaySymbol> symbol_definitions; //!< デフォルトの地形シンボル (色/文字).
-    std::map<int, DisplaySymbol> symbol_configs; //!< 設定変更後の地形シンボル (色/文字).
+    TerrainSymbols symbol_definitions; //!< デフォルトの地形シンボル (色/文字).
+    TerrainSymbols symbol_configs; //!< 設定変更後の地形シンボル (色/文字).
 
     static bool has(TerrainCharacteristics tc, TerrainAction ta);
 
@@ -75,6 +76,6 @@ public:
     void reset_lighting(bool is_config = true);
 
 private:
-    void reset_lighting_ascii(std::map<int, DisplaySymbol> &symbols);
-    void reset_lighting_graphics(std::map<int, DisplaySymbol> &symbols);
+    void reset_lighting_ascii(TerrainSymbols &symbols);
+    void reset_lighting_graphics(TerrainSymbols &symbols);
 };
@@ -494,7 +494,7 @@ static std::string decide_target_floor(PlayerType *player_ptr, GridExamination *
     return ge_ptr->terrain_ptr->name;
 }
 
-static std::string describe_grid_monster_all(GridExamination *ge_ptr)
+static std::string describe_grid_monster_all(const FloorType &floor, GridExamination *ge_ptr)
 {
     if (!AngbandWorld::get_instance().wizard) {
 #ifdef JP
@@ -511,13 +511,15 @@ static std::string describe_grid_monster_all(GridExamination *ge_ptr)
         f_idx_str = std::to_string(ge_ptr->g_ptr->feat);
     }
 
+    const auto &flow_field = floor.get_flow_field();
+    const auto pos = ge_ptr->get_position();
 #ifdef JP
     return format("%s%s%s%s[%s] %x %s %d %d %d (%d,%d) %d", ge_ptr->s1, ge_ptr->name.data(), ge_ptr->s2, ge_ptr->s3, ge_ptr->info,
-        (uint)ge_ptr->g_ptr->info, f_idx_str.data(), ge_ptr->g_ptr->dists[GridFlow::NORMAL], ge_ptr->g_ptr->costs[GridFlow::NORMAL], ge_ptr->g_ptr->when,
+        (uint)ge_ptr->g_ptr->info, f_idx_str.data(), flow_field.get_distance(pos, GridFlow::NORMAL), flow_field.get_cost(pos, GridFlow::NORMAL), ge_ptr->g_ptr->when,
         ge_ptr->y, ge_ptr->x, Travel::get_instance().get_cost({ ge_ptr->y, ge_ptr->x }));
 #else
     return format("%s%s%s%s [%s] %x %s %d %d %d (%d,%d)", ge_ptr->s1, ge_ptr->s2, ge_ptr->s3, ge_ptr->name.data(), ge_ptr->info, ge_ptr->g_ptr->info,
-        f_idx_str.data(), ge_ptr->g_ptr->dists[GridFlow::NORMAL], ge_ptr->g_ptr->costs[GridFlow::NORMAL], ge_ptr->g_ptr->when, ge_ptr->y, ge_ptr->x);
+        f_idx_str.data(), flow_field.get_distance(pos, GridFlow::NORMAL), flow_field.get_cost(pos, GridFlow::NORMAL), ge_ptr->g_ptr->when, ge_ptr->y, ge_ptr->x);
 #endif
 }
 
@@ -607,7 +609,7 @@ char examine_grid(PlayerType *player_ptr, const POSITION y, const POSITION x, ta
     }
 #endif
 
-    prt(describe_grid_monster_all(ge_ptr), 0, 0);
+    prt(describe_grid_monster_all(*player_ptr->current_floor_ptr, ge_ptr), 0, 0);
     move_cursor_relative(y, x);
     ge_ptr->query = inkey();
     if ((ge_ptr->query != '\r') && (ge_ptr->query != '\n')) {
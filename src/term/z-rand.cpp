@@ -76,6 +76,23 @@ int rand_range(int a, int b)
     return rand_dist(d);
 }
 
+/*!
+ * @brief rand_range(a, b) の乱数をまとめて生成する
+ * @param values 生成した乱数を書き込む範囲
+ * @param a 最小値
+ * @param b 最大値
+ */
+void rand_range_fill(std::span<int> values, int a, int b)
+{
+    if (a >= b) {
+        std::fill(values.begin(), values.end(), a);
+        return;
+    }
+
+    std::uniform_int_distribution<> d(a, b);
+    rand_fill(values, [&d](auto &rng) { return d(rng); });
+}
+
 /*
  * Generate a random integer number of NORMAL distribution
  */
@@ -89,6 +106,27 @@ int16_t randnor(int mean, int stand)
     return static_cast<int16_t>(result);
 }
 
+/*!
+ * @brief randnor(mean, stand) の乱数をまとめて生成する
+ * @param values 生成した乱数を書き込む範囲
+ * @param mean 平均値
+ * @param stand 標準偏差
+ */
+void randnor_fill(std::span<int16_t> values, int mean, int stand)
+{
+    if (stand <= 0) {
+        std::fill(values.begin(), values.end(), static_cast<int16_t>(mean));
+        return;
+    }
+
+    // randnor() と同じ値にするため、1つ生成する毎に分布が保持している2つ目の値を捨てる
+    std::normal_distribution<> d(mean, stand);
+    rand_fill(values, [&d](auto &rng) {
+        d.reset();
+        return static_cast<int16_t>(std::round(d(rng)));
+    });
+}
+
 /*
  * Given a numerator and a denominator, supply a properly rounded result,
  * using the RNG to smooth out remainders.  -LM-
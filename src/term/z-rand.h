@@ -13,8 +13,10 @@
 #include "system/angband-exceptions.h"
 #include "system/angband-system.h"
 #include "system/h-basic.h"
+#include <algorithm>
 #include <initializer_list>
 #include <iterator>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -114,7 +116,9 @@ bool one_in_(T n)
 }
 
 void Rand_state_init();
+void rand_range_fill(std::span<int> values, int a, int b);
 int16_t randnor(int mean, int stand);
+void randnor_fill(std::span<int16_t> values, int mean, int stand);
 int32_t div_round(int32_t n, int32_t d);
 int32_t Rand_external(int32_t m);
 
@@ -138,6 +142,33 @@ typename T::result_type rand_dist(T &dist)
     return dist(AngbandSystem::get_instance().get_rng());
 }
 
+/*!
+ * @brief まとめて生成する乱数の数がこれ以下ならば、ゲームの乱数生成器をそのまま使う
+ */
+constexpr size_t RAND_FILL_LANES_THRESHOLD = 64;
+
+/*!
+ * @brief ゲームの乱数生成器から乱数をまとめて生成する
+ * @details 生成数が RAND_FILL_LANES_THRESHOLD 以下ならばゲームの乱数生成器をそのまま使い、1つずつ生成した場合と同じ値になる。
+ * それより多い場合はゲームの乱数生成器から初期化した Xoshiro128StarStarLanes を使ってまとめて生成する。
+ * いずれの場合もゲームの乱数生成器の状態が同じならば同じ値が生成される。
+ *
+ * @param values 生成した乱数を書き込む範囲
+ * @param generator 乱数生成器を引数に取り、乱数を1つ返す関数
+ */
+template <typename T, typename F>
+void rand_fill(std::span<T> values, F generator)
+{
+    auto &rng = AngbandSystem::get_instance().get_rng();
+    if (values.size() <= RAND_FILL_LANES_THRESHOLD) {
+        std::generate(values.begin(), values.end(), [&generator, &rng] { return generator(rng); });
+        return;
+    }
+
+    Xoshiro128StarStarLanes lanes(rng);
+    std::generate(values.begin(), values.end(), [&generator, &lanes] { return generator(lanes); });
+}
+
 template <typename>
 struct is_reference_wrapper : std::false_type {
 };
@@ -13,7 +13,9 @@
 #include "game-option/special-options.h"
 #include "term/gameterm.h"
 #include "term/term-color-types.h"
+#include "util/trace.h"
 #include "view/display-symbol.h"
+#include <cstring>
 
 /* Special flags in the attr data */
 #define AF_BIGTILE2 0xf0
@@ -114,10 +116,10 @@ TermCenteredOffsetSetter::~TermCenteredOffsetSetter()
  * Initialize a "term_win" (using the given window size)
  */
 term_win::term_win(TERM_LEN w, TERM_LEN h)
-    : a(h, std::vector<TERM_COLOR>(w))
-    , c(h, std::vector<char>(w))
-    , ta(h, std::vector<TERM_COLOR>(w))
-    , tc(h, std::vector<char>(w))
+    : a(w, h)
+    , c(w, h)
+    , ta(w, h)
+    , tc(w, h)
 {
 }
 
@@ -141,21 +143,14 @@ std::unique_ptr<term_win> term_win::clone() const
 void term_win::resize(TERM_LEN w, TERM_LEN h)
 {
     /* Ignore non-changes */
-    if (this->a.size() == static_cast<size_t>(h) && this->a[0].size() == static_cast<size_t>(w)) {
+    if (this->a.height() == h && this->a.width() == w) {
         return;
     }
 
-    this->a.resize(h, std::vector<TERM_COLOR>(w));
-    this->c.resize(h, std::vector<char>(w));
-    this->ta.resize(h, std::vector<TERM_COLOR>(w));
-    this->tc.resize(h, std::vector<char>(w));
-
-    for (TERM_LEN y = 0; y < h; y++) {
-        this->a[y].resize(w);
-        this->c[y].resize(w);
-        this->ta[y].resize(w);
-        this->tc[y].resize(w);
-    }
+    this->a.resize(w, h);
+    this->c.resize(w, h);
+    this->ta.resize(w, h);
+    this->tc.resize(w, h);
 
     /* Illegal cursor */
     if (this->cx >= w) {
@@ -166,6 +161,20 @@ void term_win::resize(TERM_LEN w, TERM_LEN h)
     }
 }
 
+/*!
+ * @brief 表示内容 (全ての文字・属性とカーソルの状態) が同じかを調べる
+ * @param other 比較する画面
+ * @return 同じならばtrue
+ */
+bool term_win::has_same_screen(const term_win &other) const
+{
+    if ((this->cu != other.cu) || (this->cv != other.cv) || (this->cx != other.cx) || (this->cy != other.cy)) {
+        return false;
+    }
+
+    return (this->a == other.a) && (this->c == other.c) && (this->ta == other.ta) && (this->tc == other.tc);
+}
+
 /*** External hooks ***/
 
 void term_user()
@@ -410,17 +419,17 @@ static void term_queue_chars(TERM_LEN x, TERM_LEN y, int n, TERM_COLOR a, std::s
 {
     TERM_LEN x1 = -1, x2 = -1;
 
-    auto &scr_aa = game_term->scr->a[y];
+    auto *scr_aa = game_term->scr->a[y];
 #ifdef JP
-    auto &scr_cc = game_term->scr->c[y];
+    auto *scr_cc = game_term->scr->c[y];
 
-    auto &scr_taa = game_term->scr->ta[y];
-    auto &scr_tcc = game_term->scr->tc[y];
+    auto *scr_taa = game_term->scr->ta[y];
+    auto *scr_tcc = game_term->scr->tc[y];
 #else
-    auto &scr_cc = game_term->scr->c[y];
+    auto *scr_cc = game_term->scr->c[y];
 
-    auto &scr_taa = game_term->scr->ta[y];
-    auto &scr_tcc = game_term->scr->tc[y];
+    auto *scr_taa = game_term->scr->ta[y];
+    auto *scr_tcc = game_term->scr->tc[y];
 #endif
 
 #ifdef JP
@@ -538,23 +547,102 @@ static void term_queue_chars(TERM_LEN x, TERM_LEN y, int n, TERM_COLOR a, std::s
 
 /*** Refresh routines ***/
 
+/*!
+ * @brief 2つの配列で最初に異なる要素の位置を求める
+ * @return 最初に異なる要素の位置. 全て同じならばlen
+ * @details 一定の大きさのブロックごとに memcmp() で比較し、異なるブロックだけを1要素ずつ調べる.
+ * memcmp() はSIMD命令で実装されているので、変化のない長い区間を高速に読み飛ばせる.
+ */
+template <typename T>
+static TERM_LEN find_first_mismatch(const T *lhs, const T *rhs, TERM_LEN len)
+{
+    constexpr TERM_LEN BLOCK_LEN = 32 / sizeof(T);
+    TERM_LEN x = 0;
+    while ((x + BLOCK_LEN <= len) && (std::memcmp(lhs + x, rhs + x, sizeof(T) * BLOCK_LEN) == 0)) {
+        x += BLOCK_LEN;
+    }
+
+    while ((x < len) && (lhs[x] == rhs[x])) {
+        x++;
+    }
+
+    return x;
+}
+
+/*!
+ * @brief 2つの配列で最後に異なる要素の位置を求める
+ * @return 最後に異なる要素の位置. 全て同じならば-1
+ */
+template <typename T>
+static TERM_LEN find_last_mismatch(const T *lhs, const T *rhs, TERM_LEN len)
+{
+    constexpr TERM_LEN BLOCK_LEN = 32 / sizeof(T);
+    auto x = len;
+    while ((x >= BLOCK_LEN) && (std::memcmp(lhs + x - BLOCK_LEN, rhs + x - BLOCK_LEN, sizeof(T) * BLOCK_LEN) == 0)) {
+        x -= BLOCK_LEN;
+    }
+
+    while ((x > 0) && (lhs[x - 1] == rhs[x - 1])) {
+        x--;
+    }
+
+    return x - 1;
+}
+
+/*!
+ * @brief 行の指定範囲のうち、表示中の内容と要求された内容が異なる範囲を求める
+ * @param y 行
+ * @param x1 範囲の左端
+ * @param x2 範囲の右端
+ * @return 異なる範囲の左端と右端. 全て同じならばnullopt
+ * @details 範囲外の桁は表示を更新する必要がないので、term_fresh_row_*() の走査範囲をここまで狭めてよい.
+ * 全角文字の途中で切れないよう、端が全角文字の1バイト目・2バイト目ならば1桁広げる.
+ */
+static tl::optional<std::pair<TERM_LEN, TERM_LEN>> find_changed_span(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
+{
+    const auto &old = *game_term->old;
+    const auto &scr = *game_term->scr;
+    const auto len = x2 - x1 + 1;
+    const auto first = std::min({ find_first_mismatch(old.a[y] + x1, scr.a[y] + x1, len), find_first_mismatch(old.c[y] + x1, scr.c[y] + x1, len),
+        find_first_mismatch(old.ta[y] + x1, scr.ta[y] + x1, len), find_first_mismatch(old.tc[y] + x1, scr.tc[y] + x1, len) });
+    if (first == len) {
+        return tl::nullopt;
+    }
+
+    const auto last = std::max({ find_last_mismatch(old.a[y] + x1, scr.a[y] + x1, len), find_last_mismatch(old.c[y] + x1, scr.c[y] + x1, len),
+        find_last_mismatch(old.ta[y] + x1, scr.ta[y] + x1, len), find_last_mismatch(old.tc[y] + x1, scr.tc[y] + x1, len) });
+    auto changed_x1 = x1 + first;
+    auto changed_x2 = x1 + last;
+#ifdef JP
+    if ((changed_x1 > x1) && ((old.a[y][changed_x1] & AF_KANJI2) || (scr.a[y][changed_x1] & AF_KANJI2))) {
+        changed_x1--;
+    }
+
+    if ((changed_x2 < x2) && ((old.a[y][changed_x2] & AF_KANJI1) || (scr.a[y][changed_x2] & AF_KANJI1))) {
+        changed_x2++;
+    }
+#endif
+
+    return std::make_pair(changed_x1, changed_x2);
+}
+
 /*
  * Flush a row of the current window (see "term_fresh")
  * Display text using "term_pict()"
  */
 static void term_fresh_row_pict(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
 {
-    auto &old_aa = game_term->old->a[y];
-    auto &old_cc = game_term->old->c[y];
+    auto *old_aa = game_term->old->a[y];
+    auto *old_cc = game_term->old->c[y];
 
-    const auto &scr_aa = game_term->scr->a[y];
-    const auto &scr_cc = game_term->scr->c[y];
+    const auto *scr_aa = game_term->scr->a[y];
+    const auto *scr_cc = game_term->scr->c[y];
 
-    auto &old_taa = game_term->old->ta[y];
-    auto &old_tcc = game_term->old->tc[y];
+    auto *old_taa = game_term->old->ta[y];
+    auto *old_tcc = game_term->old->tc[y];
 
-    const auto &scr_taa = game_term->scr->ta[y];
-    const auto &scr_tcc = game_term->scr->tc[y];
+    const auto *scr_taa = game_term->scr->ta[y];
+    const auto *scr_tcc = game_term->scr->tc[y];
 
     TERM_COLOR ota;
     char otc;
@@ -664,16 +752,16 @@ static void term_fresh_row_pict(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
  */
 static void term_fresh_row_both(TERM_LEN y, int x1, int x2)
 {
-    auto &old_aa = game_term->old->a[y];
-    auto &old_cc = game_term->old->c[y];
+    auto *old_aa = game_term->old->a[y];
+    auto *old_cc = game_term->old->c[y];
 
-    const auto &scr_aa = game_term->scr->a[y];
-    const auto &scr_cc = game_term->scr->c[y];
+    const auto *scr_aa = game_term->scr->a[y];
+    const auto *scr_cc = game_term->scr->c[y];
 
-    auto &old_taa = game_term->old->ta[y];
-    auto &old_tcc = game_term->old->tc[y];
-    const auto &scr_taa = game_term->scr->ta[y];
-    const auto &scr_tcc = game_term->scr->tc[y];
+    auto *old_taa = game_term->old->ta[y];
+    auto *old_tcc = game_term->old->tc[y];
+    const auto *scr_taa = game_term->scr->ta[y];
+    const auto *scr_tcc = game_term->scr->tc[y];
 
     TERM_COLOR ota;
     char otc;
@@ -865,11 +953,11 @@ static void term_fresh_row_both(TERM_LEN y, int x1, int x2)
  */
 static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
 {
-    auto &old_aa = game_term->old->a[y];
-    auto &old_cc = game_term->old->c[y];
+    auto *old_aa = game_term->old->a[y];
+    auto *old_cc = game_term->old->c[y];
 
-    const auto &scr_aa = game_term->scr->a[y];
-    const auto &scr_cc = game_term->scr->c[y];
+    const auto *scr_aa = game_term->scr->a[y];
+    const auto *scr_cc = game_term->scr->c[y];
 
     /* The "always_text" flag */
     int always_text = game_term->always_text;
@@ -1025,6 +1113,7 @@ static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
  */
 void term_fresh()
 {
+    TRACE_SCOPE("term_fresh");
     const auto &old = game_term->old;
     const auto &scr = game_term->scr;
     const auto w = game_term->wid;
@@ -1066,11 +1155,11 @@ void term_fresh()
 
         /* Wipe each row */
         for (auto y = 0; y < h; y++) {
-            auto &aa = old->a[y];
-            auto &cc = old->c[y];
+            auto *aa = old->a[y];
+            auto *cc = old->c[y];
 
-            auto &taa = old->ta[y];
-            auto &tcc = old->tc[y];
+            auto *taa = old->ta[y];
+            auto *tcc = old->tc[y];
 
             /* Wipe each column */
             for (auto x = 0; x < w; x++) {
@@ -1104,11 +1193,11 @@ void term_fresh()
             const auto tx = old->cx;
             const auto ty = old->cy;
 
-            const auto &old_aa = old->a[ty];
-            const auto &old_cc = old->c[ty];
+            const auto *old_aa = old->a[ty];
+            const auto *old_cc = old->c[ty];
 
-            const auto &old_taa = old->ta[ty];
-            const auto &old_tcc = old->tc[ty];
+            const auto *old_taa = old->ta[ty];
+            const auto *old_tcc = old->tc[ty];
             DisplaySymbol ot(old_taa[tx], old_tcc[tx]);
             auto csize = 1;
 #ifdef JP
@@ -1171,22 +1260,28 @@ void term_fresh()
 
             /* Flush each "modified" row */
             if (x1 <= x2) {
-                /* Always use "term_pict()" */
-                if (game_term->always_pict) {
-                    /* Flush the row */
-                    term_fresh_row_pict(y, x1, x2);
-                }
-
-                /* Sometimes use "term_pict()" */
-                else if (game_term->higher_pict) {
-                    /* Flush the row */
-                    term_fresh_row_both(y, x1, x2);
-                }
-
-                /* Never use "term_pict()" */
-                else {
-                    /* Flush the row */
-                    term_fresh_row_text(y, x1, x2);
+                /* Skip the columns which have not actually changed */
+                const auto changed_span = find_changed_span(y, x1, x2);
+                if (changed_span) {
+                    const auto [changed_x1, changed_x2] = *changed_span;
+
+                    /* Always use "term_pict()" */
+                    if (game_term->always_pict) {
+                        /* Flush the row */
+                        term_fresh_row_pict(y, changed_x1, changed_x2);
+                    }
+
+                    /* Sometimes use "term_pict()" */
+                    else if (game_term->higher_pict) {
+                        /* Flush the row */
+                        term_fresh_row_both(y, changed_x1, changed_x2);
+                    }
+
+                    /* Never use "term_pict()" */
+                    else {
+                        /* Flush the row */
+                        term_fresh_row_text(y, changed_x1, changed_x2);
+                    }
                 }
 
                 /* This row is all done */
@@ -1513,11 +1608,11 @@ void term_erase(int x, int y, tl::optional<int> n_opt)
     }
 
     /* Fast access */
-    auto &scr_aa = game_term->scr->a[y];
-    auto &scr_cc = game_term->scr->c[y];
+    auto *scr_aa = game_term->scr->a[y];
+    auto *scr_cc = game_term->scr->c[y];
 
-    auto &scr_taa = game_term->scr->ta[y];
-    auto &scr_tcc = game_term->scr->tc[y];
+    auto *scr_taa = game_term->scr->ta[y];
+    auto *scr_tcc = game_term->scr->tc[y];
 
 #ifdef JP
     /*
@@ -1610,11 +1705,11 @@ void term_clear()
 
     /* Wipe each row */
     for (auto y = 0; y < h; y++) {
-        auto &scr_aa = game_term->scr->a[y];
-        auto &scr_cc = game_term->scr->c[y];
+        auto *scr_aa = game_term->scr->a[y];
+        auto *scr_cc = game_term->scr->c[y];
 
-        auto &scr_taa = game_term->scr->ta[y];
-        auto &scr_tcc = game_term->scr->tc[y];
+        auto *scr_taa = game_term->scr->ta[y];
+        auto *scr_tcc = game_term->scr->tc[y];
 
         /* Wipe each column */
         for (auto x = 0; x < w; x++) {
@@ -1695,7 +1790,7 @@ void term_redraw_section(int x1, int y1, int x2, int y2)
         game_term->x2[i] = x2j;
 
         /* Clear the section so it is redrawn */
-        auto &g_ptr = game_term->old->c[i];
+        auto *g_ptr = game_term->old->c[i];
         for (auto j = x1j; j <= x2j; j++) {
             /* Hack - set the old character to "none" */
             g_ptr[j] = 0;
@@ -10,6 +10,7 @@
 
 #include "system/angband.h"
 #include "system/h-basic.h"
+#include <algorithm>
 #include <memory>
 #include <stack>
 #include <string_view>
@@ -17,23 +18,82 @@
 #include <utility>
 #include <vector>
 
+/*!
+ * @brief 画面の1つの面 (属性・文字など) を行優先で連続したメモリに格納する配列
+ * @details (x, y) の要素は plane[y][x] で参照できる. 1行分の要素は連続しているので、行の一部をそのままフックに渡せる.
+ */
+template <typename T>
+class TermPlane {
+public:
+    TermPlane(TERM_LEN w, TERM_LEN h)
+        : w(w)
+        , h(h)
+        , cells(static_cast<size_t>(w) * h)
+    {
+    }
+
+    T *operator[](TERM_LEN y)
+    {
+        return this->cells.data() + static_cast<size_t>(y) * this->w;
+    }
+
+    const T *operator[](TERM_LEN y) const
+    {
+        return this->cells.data() + static_cast<size_t>(y) * this->w;
+    }
+
+    TERM_LEN width() const
+    {
+        return this->w;
+    }
+
+    TERM_LEN height() const
+    {
+        return this->h;
+    }
+
+    bool operator==(const TermPlane<T> &other) const = default;
+
+    /*!
+     * @brief 大きさを変更する. 新旧で重なる部分の内容は保持し、広がった部分は0で埋める
+     */
+    void resize(TERM_LEN new_w, TERM_LEN new_h)
+    {
+        TermPlane<T> resized(new_w, new_h);
+        const auto copy_w = std::min(this->w, new_w);
+        const auto copy_h = std::min(this->h, new_h);
+        for (TERM_LEN y = 0; y < copy_h; y++) {
+            std::copy_n((*this)[y], copy_w, resized[y]);
+        }
+
+        *this = std::move(resized);
+    }
+
+private:
+    TERM_LEN w;
+    TERM_LEN h;
+    std::vector<T> cells;
+};
+
 /*!
  * @brief A term_win is a "window" for a Term
+ * @details 属性・文字の各面はそれぞれ1つの連続したバッファに格納する.
  */
 class term_win {
 public:
     static std::unique_ptr<term_win> create(TERM_LEN w, TERM_LEN h);
     std::unique_ptr<term_win> clone() const;
     void resize(TERM_LEN w, TERM_LEN h);
+    bool has_same_screen(const term_win &other) const;
 
     bool cu{}, cv{}; //!< Cursor Useless / Visible codes
     TERM_LEN cx{}, cy{}; //!< Cursor Location (see "Useless")
 
-    std::vector<std::vector<TERM_COLOR>> a; //!< Array[h*w] -- Attribute array
-    std::vector<std::vector<char>> c; //!< Array[h*w] -- Character array
+    TermPlane<TERM_COLOR> a; //!< Array[h*w] -- Attribute array
+    TermPlane<char> c; //!< Array[h*w] -- Character array
 
-    std::vector<std::vector<TERM_COLOR>> ta; //!< Note that the attr pair at(x, y) is a[y][x]
-    std::vector<std::vector<char>> tc; //!< Note that the char pair at(x, y) is c[y][x]
+    TermPlane<TERM_COLOR> ta; //!< Note that the attr pair at(x, y) is a[y][x]
+    TermPlane<char> tc; //!< Note that the char pair at(x, y) is c[y][x]
 
 private:
     term_win(TERM_LEN w, TERM_LEN h);
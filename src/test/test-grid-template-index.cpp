@@ -0,0 +1,181 @@
+/*!
+ * @brief GridTemplateIndexクラスのテスト・ベンチマークプログラム
+ *
+ * srcディレクトリで以下のコマンドでコンパイルして実行する
+ *
+ * g++ -std=c++20 -O2 -I. -Iexternal-lib/include test/test-grid-template-index.cpp save/grid-template-index.cpp
+ *
+ * 種類の異なるフロアを模したグリッド列を生成し、従来の線形探索によるテンプレート生成と結果が一致することをassertで確認した上で、
+ * それぞれの処理時間を表示する
+ */
+
+#include "save/grid-template-index.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+constexpr auto FLOOR_HEIGHT = 66;
+constexpr auto FLOOR_WIDTH = 198;
+constexpr auto REPEAT_COUNT = 20;
+
+struct TestGrid {
+    BIT_FLAGS info;
+    FEAT_IDX feat;
+    FEAT_IDX mimic;
+    short special;
+};
+
+/*!
+ * @brief 従来の実装 (テンプレートの線形探索を2回行う)
+ */
+std::pair<std::vector<GridTemplate>, std::vector<uint16_t>> generate_by_linear_search(const std::vector<TestGrid> &grids)
+{
+    const auto matches = [](const GridTemplate &gt, const TestGrid &grid) {
+        return (gt.info == grid.info) && (gt.feat == grid.feat) && (gt.mimic == grid.mimic) && (gt.special == grid.special);
+    };
+
+    std::vector<GridTemplate> templates;
+    for (const auto &grid : grids) {
+        auto it = std::find_if(templates.begin(), templates.end(), [&](const auto &gt) { return matches(gt, grid); });
+        if (it != templates.end()) {
+            it->occurrence++;
+            continue;
+        }
+
+        templates.emplace_back(grid.info, grid.feat, grid.mimic, grid.special, static_cast<uint16_t>(1));
+    }
+
+    std::stable_sort(templates.begin(), templates.end(), [](const auto &x, const auto &y) { return x.occurrence < y.occurrence; });
+    std::vector<uint16_t> ids;
+    for (const auto &grid : grids) {
+        const auto it = std::find_if(templates.begin(), templates.end(), [&](const auto &gt) { return matches(gt, grid); });
+        ids.push_back(static_cast<uint16_t>(std::distance(templates.begin(), it)));
+    }
+
+    return { templates, ids };
+}
+
+/*!
+ * @brief 洞窟風のフロア (地形の種類が少なく、テンプレートも数十個程度)
+ */
+std::vector<TestGrid> make_cave_floor(std::mt19937 &mt)
+{
+    std::vector<TestGrid> grids;
+    std::uniform_int_distribution<> dist(0, 99);
+    for (auto i = 0; i < FLOOR_HEIGHT * FLOOR_WIDTH; i++) {
+        const auto roll = dist(mt);
+        const FEAT_IDX feat = roll < 55 ? 1 : (roll < 90 ? 56 : (roll < 97 ? 87 : 88));
+        const BIT_FLAGS info = (roll % 3 == 0) ? 0x0201 : 0x0000;
+        grids.push_back({ info, feat, 0, 0 });
+    }
+
+    return grids;
+}
+
+/*!
+ * @brief 部屋と通路のフロア (部屋ごとに照明やフラグが異なる)
+ */
+std::vector<TestGrid> make_room_floor(std::mt19937 &mt)
+{
+    std::vector<TestGrid> grids(FLOOR_HEIGHT * FLOOR_WIDTH, { 0x0000, 56, 0, 0 });
+    std::uniform_int_distribution<> dist_y(1, FLOOR_HEIGHT - 12);
+    std::uniform_int_distribution<> dist_x(1, FLOOR_WIDTH - 22);
+    std::uniform_int_distribution<> dist_info(0, 15);
+    for (auto room = 0; room < 30; room++) {
+        const auto y1 = dist_y(mt);
+        const auto x1 = dist_x(mt);
+        const BIT_FLAGS info = 0x0008 | (dist_info(mt) << 9);
+        for (auto y = y1; y < y1 + 10; y++) {
+            for (auto x = x1; x < x1 + 20; x++) {
+                grids[y * FLOOR_WIDTH + x] = { info, 1, 0, 0 };
+            }
+        }
+    }
+
+    return grids;
+}
+
+/*!
+ * @brief Vaultだらけのフロア (異なる組が数千個出現する)
+ */
+std::vector<TestGrid> make_vault_floor(std::mt19937 &mt)
+{
+    auto grids = make_room_floor(mt);
+    std::uniform_int_distribution<> dist_feat(1, 40);
+    std::uniform_int_distribution<> dist_mimic(0, 3);
+    std::uniform_int_distribution<> dist_special(0, 2);
+    std::uniform_int_distribution<> dist_info(0, 7);
+    for (auto y = 10; y < 50; y++) {
+        for (auto x = 20; x < 170; x++) {
+            grids[y * FLOOR_WIDTH + x] = {
+                static_cast<BIT_FLAGS>(0x000C | (dist_info(mt) << 9)),
+                static_cast<FEAT_IDX>(dist_feat(mt)),
+                static_cast<FEAT_IDX>(dist_mimic(mt)),
+                static_cast<short>(dist_special(mt)),
+            };
+        }
+    }
+
+    return grids;
+}
+
+template <typename F>
+double measure_msec(F &&func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < REPEAT_COUNT; i++) {
+        func();
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count() / REPEAT_COUNT;
+}
+
+void test(std::string_view name, const std::vector<TestGrid> &grids)
+{
+    const auto [expected_templates, expected_ids] = generate_by_linear_search(grids);
+    GridTemplateIndex index(grids.size());
+    for (const auto &grid : grids) {
+        index.add(grid.info, grid.feat, grid.mimic, grid.special);
+    }
+
+    index.sort_by_occurrence();
+    const auto &templates = index.get_templates();
+    assert(templates.size() == expected_templates.size());
+    for (size_t i = 0; i < templates.size(); i++) {
+        assert(templates[i].info == expected_templates[i].info);
+        assert(templates[i].feat == expected_templates[i].feat);
+        assert(templates[i].mimic == expected_templates[i].mimic);
+        assert(templates[i].special == expected_templates[i].special);
+        assert(templates[i].occurrence == expected_templates[i].occurrence);
+    }
+
+    assert(index.get_template_ids() == expected_ids);
+
+    const auto linear_msec = measure_msec([&grids] { (void)generate_by_linear_search(grids); });
+    const auto hashed_msec = measure_msec([&grids] {
+        GridTemplateIndex index(grids.size());
+        for (const auto &grid : grids) {
+            index.add(grid.info, grid.feat, grid.mimic, grid.special);
+        }
+
+        index.sort_by_occurrence();
+    });
+
+    printf("%-6s templates = %5zu, linear = %8.3f ms, hashed = %8.3f ms\n", name.data(), templates.size(), linear_msec, hashed_msec);
+}
+}
+
+int main()
+{
+    std::mt19937 mt(std::random_device{}());
+    test("cave", make_cave_floor(mt));
+    test("room", make_room_floor(mt));
+    test("vault", make_vault_floor(mt));
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*!
+ * @brief 複数の部分文字列の一括検索のテストプログラム
+ *
+ * srcディレクトリで以下のコマンドでコンパイルして実行する
+ *
+ * g++ -std=c++20 -O2 -DJP -DEUC -I. -Iexternal-lib/include test/test-multi-pattern-matcher.cpp util/multi-pattern-matcher.cpp util/string-processor.cpp main-unix/stack-trace-unix.cpp system/angband-version.cpp term/z-form.cpp term/z-util.cpp
+ *
+ * MultiPatternMatcher::find_all() の結果が、パターンごとに angband_strstr() で調べた結果と一致することをassertで確認する.
+ * 2バイト文字の2バイト目から始まる一致を含まないことを確かめるため、-DJP -DEUC を付けてコンパイルすること
+ */
+
+#include "util/multi-pattern-matcher.h"
+#include "util/string-processor.h"
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+/*!
+ * @brief パターンを登録した MultiPatternMatcher の結果を angband_strstr() と比べる
+ * @param patterns 登録するパターン
+ * @param texts 検索する文字列
+ */
+void test_matches(const std::vector<std::string> &patterns, const std::vector<std::string> &texts)
+{
+    MultiPatternMatcher matcher;
+    for (const auto &pattern : patterns) {
+        [[maybe_unused]] const auto id = matcher.add(pattern);
+        assert(id == matcher.size() - 1);
+    }
+
+    matcher.build();
+    for (const auto &text : texts) {
+        const auto matched = matcher.find_all(text);
+        assert(matched.size() == patterns.size());
+        for (size_t i = 0; i < patterns.size(); i++) {
+            assert(matched[i] == (angband_strstr(text.data(), patterns[i]) != nullptr));
+        }
+    }
+}
+}
+
+int main()
+{
+    /* 空のパターンは空文字列を含め常に一致する */
+    test_matches({ "", "a" }, { "", "a", "b" });
+    {
+        MultiPatternMatcher matcher;
+        matcher.add("");
+        matcher.build();
+        assert(matcher.find_all("")[0]);
+        assert(matcher.find_all("anything")[0]);
+    }
+
+    /* 接頭辞・接尾辞を共有するパターンと失敗遷移 */
+    test_matches({ "he", "she", "his", "hers", "ring", "ring of speed", "of" },
+        { "ushers", "ahishers", "ring of speed", "a ring", "rin", "speed", "of", "" });
+
+    /* パターンを1つも登録しなければ何も返さない */
+    {
+        MultiPatternMatcher matcher;
+        matcher.build();
+        assert(matcher.find_all("text").empty());
+    }
+
+#ifdef JP
+    /* EUC-JP の "あい" の2バイト目と3バイト目に跨る "\xa2\xa4" は一致しない */
+    const std::string ai = "\xa4\xa2\xa4\xa4";
+    {
+        MultiPatternMatcher matcher;
+        matcher.add("\xa2\xa4");
+        matcher.add("\xa4\xa4");
+        matcher.build();
+        const auto matched = matcher.find_all(ai);
+        assert(!matched[0]);
+        assert(matched[1]);
+    }
+
+    /* 失敗遷移で2バイト目の位置から照合を再開しても、2バイト目から始まる一致を含まない */
+    test_matches({ "\xa2\xa4", "\xa4\xa2\xa4\xa2", "\xa4\xa4", "a\xa4", "\xa4" },
+        { ai, "a" + ai, ai + ai, "\xa4\xa2\xa4\xa2\xa4\xa4", "x\xa4\xa2" });
+#endif
+
+    std::puts("OK");
+    return 0;
+}
@@ -3,16 +3,19 @@
  *
  * srcディレクトリで以下のコマンドでコンパイルして実行する
  *
- * g++ -std=c++20 -I. test/test-probability-table.cpp util/rng-xoshiro.cpp term/z-rand.cpp system/angband-system.cpp main-unix/stack-trace-unix.cpp system/angband-version.cpp term/z-form.cpp term/z-util.cpp
+ * g++ -std=c++20 -O2 -I. test/test-probability-table.cpp util/rng-xoshiro.cpp term/z-rand.cpp system/angband-system.cpp main-unix/stack-trace-unix.cpp system/angband-version.cpp term/z-form.cpp term/z-util.cpp
  *
  * 実行すると永久にテストを繰り返し、想定通りの確率で抽選されていなければassertでプログラムが停止する
+ * 引数に bench を指定して実行すると、std::discrete_distribution との抽選速度の比較を表示して終了する
  */
 
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <numeric>
 #include <random>
+#include <string_view>
 
 #include "system/angband-system.h"
 #include "util/probability-table.h"
@@ -129,8 +132,78 @@ static int test_main()
     return 0;
 }
 
-int main()
+/*!
+ * @brief 抽選1回あたりの所要時間を計測する
+ * @param pick 抽選処理. 戻り値は最適化で消されないよう合計する
+ * @param count 抽選を行う回数
+ * @return 抽選1回あたりの所要時間 (ナノ秒)
+ */
+template <typename F>
+static double measure_ns(F pick, int count)
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto sum = 0LL;
+    for (auto i = 0; i < count; i++) {
+        sum += pick();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    volatile auto sink = sum;
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / count;
+}
+
+static void benchmark()
+{
+    std::random_device rd;
+    std::mt19937 mt(rd());
+    Xoshiro128StarStar xoshiro(rd());
+    AngbandSystem::get_instance().set_rng(xoshiro);
+    auto &rng = AngbandSystem::get_instance().get_rng();
+
+    constexpr auto LOTTERY_COUNT = 2000000;
+    std::uniform_int_distribution<> prob_dist(1, 1000);
+    for (const auto item_count : { 3, 64, 1000, 4000 }) {
+        ProbabilityTable<int> table;
+        std::vector<int> probs;
+        for (auto i = 0; i < item_count; i++) {
+            probs.push_back(prob_dist(mt));
+            table.entry_item(i, probs.back());
+        }
+
+        std::discrete_distribution<int> dist(probs.begin(), probs.end());
+        const auto discrete_ns = measure_ns([&] { return dist(rng); }, LOTTERY_COUNT);
+        const auto alias_ns = measure_ns([&] { return table.pick_one_at_random(); }, LOTTERY_COUNT);
+
+        std::vector<int> result;
+        result.reserve(LOTTERY_COUNT);
+        const auto start = std::chrono::steady_clock::now();
+        ProbabilityTable<int>::lottery(std::back_inserter(result), table, LOTTERY_COUNT);
+        const auto lottery_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / LOTTERY_COUNT;
+
+        // 毎回テーブルを作り直す場合 (一時テーブルで1回だけ抽選する使い方) の比較
+        constexpr auto REBUILD_COUNT = 20000;
+        const auto discrete_rebuild_ns = measure_ns([&] { return std::discrete_distribution<int>(probs.begin(), probs.end())(rng); }, REBUILD_COUNT);
+        const auto alias_rebuild_ns = measure_ns([&] {
+            table.clear();
+            for (auto i = 0; i < item_count; i++) {
+                table.entry_item(i, probs[i]);
+            }
+            return table.pick_one_at_random();
+        },
+            REBUILD_COUNT);
+
+        printf("items = %4d: discrete_distribution %6.1f ns, alias %6.1f ns, lottery %6.1f ns / pick; rebuild+pick: discrete_distribution %9.1f ns, alias %9.1f ns\n",
+            item_count, discrete_ns, alias_ns, lottery_ns, discrete_rebuild_ns, alias_rebuild_ns);
+    }
+}
+
+int main(int argc, char *argv[])
 {
+    if ((argc > 1) && (std::string_view(argv[1]) == "bench")) {
+        benchmark();
+        return 0;
+    }
+
     while (true) {
         test_main();
     }
@@ -0,0 +1,66 @@
+/*!
+ * @brief 乱数のまとめて生成のテストプログラム
+ *
+ * srcディレクトリで以下のコマンドでコンパイルして実行する
+ *
+ * g++ -std=c++20 -O2 -I. -Iexternal-lib/include test/test-rand-fill.cpp util/dice.cpp util/rng-xoshiro.cpp term/z-rand.cpp system/angband-system.cpp main-unix/stack-trace-unix.cpp system/angband-version.cpp term/z-form.cpp term/z-util.cpp util/string-processor.cpp
+ *
+ * 生成数が RAND_FILL_LANES_THRESHOLD 以下ならば、*_fill() が1つずつ生成した場合と同じ値になり、
+ * 乱数生成器の状態も同じだけ進むことをassertで確認する
+ */
+
+#include "system/angband-system.h"
+#include "term/z-rand.h"
+#include "util/dice.h"
+#include "util/rng-xoshiro.h"
+#include <cassert>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+namespace {
+/*!
+ * @brief 同じ乱数の状態から、まとめて生成した場合と1つずつ生成した場合の結果を比べる
+ * @param fill まとめて生成する関数
+ * @param single 1つ生成する関数
+ */
+template <typename T>
+void test_fill(const std::function<void(std::span<T>)> &fill, const std::function<T()> &single)
+{
+    auto &system = AngbandSystem::get_instance();
+    for (size_t size = 0; size <= RAND_FILL_LANES_THRESHOLD; size++) {
+        const auto rng = system.get_rng();
+        std::vector<T> filled(size);
+        fill(filled);
+        const auto rng_after_fill = system.get_rng().get_state();
+
+        system.set_rng(rng);
+        std::vector<T> expected;
+        for (size_t i = 0; i < size; i++) {
+            expected.push_back(single());
+        }
+
+        assert(filled == expected);
+        assert(system.get_rng().get_state() == rng_after_fill);
+    }
+}
+}
+
+int main()
+{
+    AngbandSystem::get_instance().get_rng().set_state({ 1, 2, 3, 4 });
+    for (const auto &[a, b] : { std::pair{ 0, 0 }, std::pair{ 3, 1 }, std::pair{ 1, 6 }, std::pair{ -100, 100 }, std::pair{ 0, 1000000 } }) {
+        test_fill<int>([a, b](std::span<int> values) { rand_range_fill(values, a, b); }, [a, b] { return rand_range(a, b); });
+    }
+
+    for (const auto &[mean, stand] : { std::pair{ 10, 0 }, std::pair{ 0, 1 }, std::pair{ 100, 25 }, std::pair{ -50, 300 } }) {
+        test_fill<int16_t>([mean, stand](std::span<int16_t> values) { randnor_fill(values, mean, stand); }, [mean, stand] { return randnor(mean, stand); });
+    }
+
+    for (const auto &[num, sides] : { std::pair{ 0, 6 }, std::pair{ 1, 1 }, std::pair{ 3, 0 }, std::pair{ 2, -1 }, std::pair{ 3, 6 }, std::pair{ 10, 100 }, std::pair{ 2, -8 } }) {
+        test_fill<int>([num, sides](std::span<int> values) { Dice::roll_fill(values, num, sides); }, [num, sides] { return Dice::roll(num, sides); });
+    }
+
+    puts("OK");
+    return 0;
+}
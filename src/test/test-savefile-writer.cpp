@@ -0,0 +1,140 @@
+/*!
+ * @brief セーブファイル書き込みバッファのテストプログラム
+ *
+ * srcディレクトリで以下のコマンドでコンパイルして実行する
+ *
+ * g++ -std=c++20 -O2 -I. -Iexternal-lib/include test/test-savefile-writer.cpp save/save-util.cpp
+ *
+ * ダンジョン内でのセーブ (wr_dungeon() の途中で save_floor(SLF_SECOND) が呼ばれる) と同じ順序で、
+ * セーブファイルへの書き込みの途中にメモリ上への一時保存データの書き込みを挟み、
+ * どちらも書き込んだ通りに復号できることをassertで確認する
+ */
+
+#include "save/save-util.h"
+#include <cassert>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+std::vector<byte> make_random_bytes(std::mt19937 &rng, size_t size)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<byte> bytes(size);
+    for (auto &b : bytes) {
+        b = static_cast<byte>(dist(rng));
+    }
+
+    return bytes;
+}
+
+void write_bytes(const std::vector<byte> &bytes)
+{
+    for (const auto b : bytes) {
+        wr_byte(b);
+    }
+}
+
+std::vector<byte> decode(const std::vector<byte> &encoded)
+{
+    std::vector<byte> decoded;
+    byte xor_byte = 0;
+    for (const auto b : encoded) {
+        decoded.push_back(b ^ xor_byte);
+        xor_byte = b;
+    }
+
+    return decoded;
+}
+
+std::vector<byte> read_all(FILE *fp)
+{
+    std::vector<byte> bytes;
+    rewind(fp);
+    for (auto c = fgetc(fp); c != EOF; c = fgetc(fp)) {
+        bytes.push_back(static_cast<byte>(c));
+    }
+
+    return bytes;
+}
+
+/*!
+ * @brief save_floor(SLF_SECOND) と同じ手順でメモリ上に一時保存データを書き込む
+ */
+std::vector<byte> save_floor_image(const std::vector<byte> &floor_bytes)
+{
+    const auto is_flushed = flush_savefile();
+    assert(is_flushed);
+    auto *old_fff = saving_savefile;
+    const auto old_xor_byte = save_xor_byte;
+    const auto old_v_stamp = v_stamp;
+    const auto old_x_stamp = x_stamp;
+
+    saving_savefile = nullptr;
+    const auto is_began = begin_savefile_image();
+    assert(is_began);
+    save_xor_byte = 0;
+    v_stamp = 0;
+    x_stamp = 0;
+    write_bytes(floor_bytes);
+    auto image = end_savefile_image();
+
+    saving_savefile = old_fff;
+    save_xor_byte = old_xor_byte;
+    v_stamp = old_v_stamp;
+    x_stamp = old_x_stamp;
+    return image;
+}
+
+void test_nested_floor_save(std::mt19937 &rng, size_t head_size, size_t floor_size, size_t tail_size)
+{
+    auto *fp = tmpfile();
+    assert(fp != nullptr);
+    saving_savefile = fp;
+    save_xor_byte = 0;
+    v_stamp = 0;
+    x_stamp = 0;
+
+    const auto head = make_random_bytes(rng, head_size);
+    const auto floor_bytes = make_random_bytes(rng, floor_size);
+    const auto tail = make_random_bytes(rng, tail_size);
+
+    /* セーブファイル側の書き込みはバッファに残ったまま一時保存に切り替わる */
+    write_bytes(head);
+    const auto image = save_floor_image(floor_bytes);
+    write_bytes(tail);
+    const auto is_flushed = flush_savefile();
+    assert(is_flushed);
+
+    auto expected = head;
+    expected.insert(expected.end(), tail.begin(), tail.end());
+    assert(decode(read_all(fp)) == expected);
+    assert(decode(image) == floor_bytes);
+
+    fclose(fp);
+    saving_savefile = nullptr;
+}
+
+/*!
+ * @brief ゲームの読み込み中 (書き込み中のファイルが無い状態) の一時保存
+ */
+void test_floor_save_without_file(std::mt19937 &rng)
+{
+    saving_savefile = nullptr;
+    const auto floor_bytes = make_random_bytes(rng, 1000);
+    const auto image = save_floor_image(floor_bytes);
+    assert(decode(image) == floor_bytes);
+}
+}
+
+int main()
+{
+    std::mt19937 rng(12345);
+    test_nested_floor_save(rng, 0, 100, 100);
+    test_nested_floor_save(rng, 100, 100, 100);
+    test_nested_floor_save(rng, 70000, 200000, 70000);
+    test_nested_floor_save(rng, 65535, 1, 65537);
+    test_floor_save_without_file(rng);
+    puts("OK");
+    return 0;
+}
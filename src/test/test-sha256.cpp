@@ -3,18 +3,24 @@
  *
  * srcディレクトリで以下のコマンドでコンパイルして実行する
  *
- * g++ -std=c++20 -I. term/z-util.cpp term/z-form.cpp system/angband-version.cpp util/sha256.cpp test/test-sha256.cpp
+ * g++ -std=c++20 -O2 -I. term/z-util.cpp term/z-form.cpp system/angband-version.cpp util/sha256.cpp test/test-sha256.cpp
  *
  * 引数を指定した場合は、そのファイルのハッシュ値を計算する
- * 引数がない場合は、RFC 6234のテストドライバより抜粋したSHA-256のテストパターンのハッシュ値を計算して比較する
+ * 引数がない場合は、RFC 6234のテストドライバより抜粋したSHA-256のテストパターンのハッシュ値を計算して比較する.
+ * その後、同じデータを様々な大きさに分割して追加してもハッシュ値が変わらないことを確認し、分割サイズ毎の処理速度を表示する
  */
 
 #include "util/sha256.h"
 
+#include <array>
 #include <cassert>
+#include <chrono>
+#include <cstdio>
 #include <iostream>
+#include <random>
 #include <span>
 #include <string_view>
+#include <vector>
 
 /*
  * RFC 6234 で定義されているテストパターン
@@ -56,6 +62,9 @@
     "\x9f\xdd\x30\x82\x57\x69\xb2\xc6\x71\xaf\x67\x59\xdf\x28\xeb\x39" \
     "\x3d\x54\xd6"
 
+constexpr size_t BENCHMARK_DATA_SIZE = 16 * 1024 * 1024;
+constexpr std::array<size_t, 7> BENCHMARK_CHUNK_SIZES{ { 1, 7, 64, 100, 1024, 65536, BENCHMARK_DATA_SIZE } };
+
 template <size_t N>
 constexpr auto length(const char (&)[N])
 {
@@ -108,4 +117,29 @@ int main(int argc, char *argv[])
 
         assert(util::to_string(hash.digest()) == test.expected);
     }
+
+    std::vector<std::byte> data(BENCHMARK_DATA_SIZE);
+    std::mt19937 mt(std::random_device{}());
+    std::uniform_int_distribution<> dist(0, 255);
+    for (auto &b : data) {
+        b = std::byte(dist(mt));
+    }
+
+    hash.reset();
+    hash.update(data);
+    const auto expected = hash.digest();
+    for (const auto chunk_size : BENCHMARK_CHUNK_SIZES) {
+        const auto start = std::chrono::steady_clock::now();
+        hash.reset();
+        for (std::span remain(data); !remain.empty();) {
+            const auto chunk = remain.first(std::min(chunk_size, remain.size()));
+            hash.update(chunk);
+            remain = remain.subspan(chunk.size());
+        }
+
+        const auto digest = hash.digest();
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        assert(digest == expected);
+        printf("chunk = %8zu bytes: %7.1f MB/s\n", chunk_size, BENCHMARK_DATA_SIZE / elapsed / 1e6);
+    }
 }
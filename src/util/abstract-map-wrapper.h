@@ -83,6 +83,10 @@ public:
     {
         return this->get_inner_container().contains(key);
     }
+    void clear() noexcept
+    {
+        this->get_inner_container().clear();
+    }
 
 private:
     virtual Container &get_inner_container() = 0;
@@ -2,6 +2,9 @@
 #include "system/angband-exceptions.h"
 #include "term/z-rand.h"
 #include "util/string-processor.h"
+#include <algorithm>
+#include <cstdlib>
+#include <random>
 #include <sstream>
 
 Dice::Dice()
@@ -32,6 +35,33 @@ int Dice::roll(int num, int sides)
     return sum;
 }
 
+/*!
+ * @brief 面数sidesのダイスをnum個振った出目の合計をまとめて求める
+ *
+ * @param values 出目の合計を書き込む範囲
+ * @param num ダイスの数
+ * @param sides ダイスの面数
+ */
+void Dice::roll_fill(std::span<int> values, int num, int sides)
+{
+    // 出目が1通りしかなければ乱数は使わない (randint1() と同じ)
+    const auto abs_sides = std::abs(sides);
+    if (abs_sides <= 1) {
+        std::fill(values.begin(), values.end(), std::max(num, 0) * ((sides == 0) ? 1 : sides));
+        return;
+    }
+
+    const auto sign = (sides > 0) ? 1 : -1;
+    std::uniform_int_distribution<> d(1, abs_sides);
+    rand_fill(values, [&d, num, sign](auto &rng) {
+        auto sum = 0;
+        for (auto i = 0; i < num; i++) {
+            sum += d(rng);
+        }
+        return sum * sign;
+    });
+}
+
 /*!
  * @brief 面数sidesのダイスをnum個振った時に出る可能性のある出目の合計の最大値を返す
  *
@@ -133,6 +163,11 @@ int Dice::roll() const
     return Dice::roll(this->num, this->sides);
 }
 
+void Dice::roll_fill(std::span<int> values) const
+{
+    Dice::roll_fill(values, this->num, this->sides);
+}
+
 int Dice::maxroll() const
 {
     return Dice::maxroll(this->num, this->sides);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -9,6 +10,7 @@ public:
     Dice(int num, int sides);
 
     static int roll(int num, int sides);
+    static void roll_fill(std::span<int> values, int num, int sides);
     static int maxroll(int num, int sides);
     static double expected_value(int num, int sides);
     static int floored_expected_value(int num, int sides, int mult = 1);
@@ -17,6 +19,7 @@ public:
 
     bool is_valid() const;
     int roll() const;
+    void roll_fill(std::span<int> values) const;
     int maxroll() const;
     double expected_value() const;
     int floored_expected_value() const;
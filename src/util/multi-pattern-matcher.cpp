@@ -0,0 +1,136 @@
+#include "util/multi-pattern-matcher.h"
+#include "system/angband.h"
+#include <queue>
+
+MultiPatternMatcher::MultiPatternMatcher()
+{
+    this->clear();
+}
+
+/*!
+ * @brief 登録したパターンを全て削除する
+ */
+void MultiPatternMatcher::clear()
+{
+    this->nodes.assign(1, Node());
+    this->pattern_num = 0;
+}
+
+/*!
+ * @brief パターンを登録する. 検索の前に build() を呼ぶこと
+ * @param pattern パターン
+ * @return パターンの番号 (find_all() の結果の添字)
+ */
+int MultiPatternMatcher::add(std::string_view pattern)
+{
+    auto node_id = 0;
+    for (const auto ch : pattern) {
+        auto child_id = this->find_child(node_id, ch);
+        if (child_id < 0) {
+            child_id = static_cast<int>(this->nodes.size());
+            this->nodes[node_id].children.emplace_back(ch, child_id);
+            auto &child = this->nodes.emplace_back();
+            child.depth = this->nodes[node_id].depth + 1;
+        }
+
+        node_id = child_id;
+    }
+
+    this->nodes[node_id].pattern_ids.push_back(this->pattern_num);
+    return this->pattern_num++;
+}
+
+/*!
+ * @brief 登録したパターンから失敗時の遷移先を構築する
+ */
+void MultiPatternMatcher::build()
+{
+    std::queue<int> queue;
+    for (const auto &[ch, child_id] : this->nodes[0].children) {
+        this->nodes[child_id].failure = 0;
+        queue.push(child_id);
+    }
+
+    while (!queue.empty()) {
+        const auto node_id = queue.front();
+        queue.pop();
+        for (const auto &[ch, child_id] : this->nodes[node_id].children) {
+            const auto failure = this->transit(this->nodes[node_id].failure, ch);
+            auto &child = this->nodes[child_id];
+            child.failure = failure;
+            child.output = this->nodes[failure].pattern_ids.empty() ? this->nodes[failure].output : failure;
+            queue.push(child_id);
+        }
+    }
+}
+
+int MultiPatternMatcher::size() const
+{
+    return this->pattern_num;
+}
+
+/*!
+ * @brief 文字列中に現れるパターンを調べる
+ * @param text 検索対象の文字列
+ * @return パターンの番号ごとの、一致したか否か
+ */
+std::vector<bool> MultiPatternMatcher::find_all(std::string_view text) const
+{
+    std::vector<bool> matched(this->pattern_num);
+    for (const auto pattern_id : this->nodes[0].pattern_ids) {
+        matched[pattern_id] = true;
+    }
+
+    std::vector<bool> is_char_head(text.size(), true);
+#ifdef JP
+    for (size_t i = 0; i < text.size(); i++) {
+        if (iskanji(text[i]) && (i + 1 < text.size())) {
+            is_char_head[++i] = false;
+        }
+    }
+#endif
+
+    auto node_id = 0;
+    for (size_t i = 0; i < text.size(); i++) {
+        node_id = this->transit(node_id, text[i]);
+        for (auto id = this->nodes[node_id].pattern_ids.empty() ? this->nodes[node_id].output : node_id; id > 0; id = this->nodes[id].output) {
+            const auto &node = this->nodes[id];
+            if (!is_char_head[i + 1 - node.depth]) {
+                continue;
+            }
+
+            for (const auto pattern_id : node.pattern_ids) {
+                matched[pattern_id] = true;
+            }
+        }
+    }
+
+    return matched;
+}
+
+int MultiPatternMatcher::find_child(int node_id, char ch) const
+{
+    for (const auto &[child_ch, child_id] : this->nodes[node_id].children) {
+        if (child_ch == ch) {
+            return child_id;
+        }
+    }
+
+    return -1;
+}
+
+int MultiPatternMatcher::transit(int node_id, char ch) const
+{
+    while (true) {
+        const auto child_id = this->find_child(node_id, ch);
+        if (child_id >= 0) {
+            return child_id;
+        }
+
+        if (node_id == 0) {
+            return 0;
+        }
+
+        node_id = this->nodes[node_id].failure;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+/*!
+ * @file multi-pattern-matcher.h
+ * @brief 複数の部分文字列の一括検索 (Aho-Corasick法)
+ */
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*!
+ * @brief 登録した全てのパターンについて、文字列中に部分文字列として現れるかを1回の走査で調べる
+ * @details 結果は angband_strstr() と同じく、2バイト文字の2バイト目から始まる一致を含まない.
+ * 空のパターンは常に一致する.
+ */
+class MultiPatternMatcher {
+public:
+    MultiPatternMatcher();
+
+    void clear();
+    int add(std::string_view pattern);
+    void build();
+    int size() const;
+    std::vector<bool> find_all(std::string_view text) const;
+
+private:
+    /*!
+     * @brief トライ木のノード
+     */
+    struct Node {
+        std::vector<std::pair<char, int>> children;
+        int failure = 0; //!< 一致に失敗した時の遷移先 (このノードの文字列の最長の真の接尾辞に当たるノード)
+        int output = -1; //!< 接尾辞のうちパターンの末尾に当たる最長のノード
+        int depth = 0;
+        std::vector<int> pattern_ids; //!< このノードで終わるパターン
+    };
+
+    std::vector<Node> nodes;
+    int pattern_num = 0;
+
+    int find_child(int node_id, char ch) const;
+    int transit(int node_id, char ch) const;
+};
@@ -3,18 +3,19 @@
 #include "system/angband-exceptions.h"
 #include "term/z-rand.h"
 #include <algorithm>
+#include <cstdint>
 #include <exception>
-#include <numeric>
 #include <random>
 #include <stdexcept>
-#include <tl/optional.hpp>
-#include <tuple>
 #include <vector>
 
 /**
  * @brief 確率テーブルクラス
  *
  * 確率テーブルを作成し、確率に従った抽選を行うクラス
+ * 抽選はWalker/Voseのエイリアス法で行う。テーブルの構築は2回目の抽選時にO(n)、以降の抽選は1回あたりO(1)となる。
+ * 項目を登録して1回だけ抽選する使い方が多いので、最初の1回はテーブルを構築せずに線形探索で抽選する。
+ * clear() しても内部のバッファは解放しないので、同じオブジェクトを使い回せば再構築時のメモリ確保は発生しない。
  *
  * @tparam IdType 確率テーブルに登録するIDの型
  */
@@ -30,11 +31,29 @@ public:
 
     /**
      * @brief 確率テーブルを空にする
+     *
+     * 登録済の項目を取り除く。確保済のバッファはそのまま再利用する。
      */
     void clear()
     {
-        dist_.reset();
-        item_list_.clear();
+        ids_.clear();
+        probs_.clear();
+        total_prob_ = 0;
+        is_built_ = false;
+        is_picked_ = false;
+    }
+
+    /**
+     * @brief 確率テーブルのバッファを予約する
+     *
+     * @param count 登録する予定の項目数
+     */
+    void reserve(size_t count)
+    {
+        ids_.reserve(count);
+        probs_.reserve(count);
+        thresholds_.reserve(count);
+        aliases_.reserve(count);
     }
 
     /**
@@ -52,8 +71,11 @@ public:
     void entry_item(IdType id, int prob)
     {
         if (prob > 0) {
-            item_list_.emplace_back(id, prob);
-            dist_.reset();
+            ids_.push_back(id);
+            probs_.push_back(prob);
+            total_prob_ += prob;
+            is_built_ = false;
+            is_picked_ = false;
         }
     }
 
@@ -66,12 +88,7 @@ public:
      */
     int total_prob() const
     {
-        auto total = std::transform_reduce(
-            item_list_.begin(), item_list_.end(), 0,
-            [](int a, int b) { return a + b; },
-            [](const auto &i) { return std::get<1>(i); });
-
-        return total;
+        return static_cast<int>(total_prob_);
     }
 
     /**
@@ -84,7 +101,7 @@ public:
      */
     size_t item_count() const
     {
-        return item_list_.size();
+        return ids_.size();
     }
 
     /**
@@ -95,7 +112,7 @@ public:
      */
     bool empty() const
     {
-        return item_list_.empty();
+        return ids_.empty();
     }
 
     /**
@@ -116,14 +133,14 @@ public:
             THROW_EXCEPTION(std::runtime_error, "There is no entry in the probability table.");
         }
 
-        if (!dist_) {
-            std::vector<int> probs(item_list_.size());
-            std::transform(item_list_.begin(), item_list_.end(), probs.begin(), [](const auto &item) { return std::get<1>(item); });
-            dist_ = std::discrete_distribution<>(probs.begin(), probs.end());
+        auto &rng = AngbandSystem::get_instance().get_rng();
+        if (!is_built_ && !is_picked_) {
+            is_picked_ = true;
+            return pick_linear(rng);
         }
 
-        const auto choice = rand_dist(*dist_);
-        return std::get<0>(item_list_[choice]);
+        build();
+        return pick_built(rng);
     }
 
     /**
@@ -141,12 +158,99 @@ public:
     template <typename OutputIter>
     static void lottery(OutputIter first, const ProbabilityTable &table, size_t n)
     {
-        std::generate_n(first, n, [&table] { return table.pick_one_at_random(); });
+        if (n == 0) {
+            return;
+        }
+
+        if (table.empty()) {
+            THROW_EXCEPTION(std::runtime_error, "There is no entry in the probability table.");
+        }
+
+        table.build();
+        auto &rng = AngbandSystem::get_instance().get_rng();
+        std::generate_n(first, n, [&table, &rng] { return table.pick_built(rng); });
     }
 
 private:
-    /** 項目のIDと確率のセットを格納する配列 */
-    std::vector<std::tuple<IdType, int>> item_list_;
+    std::vector<IdType> ids_; //!< 項目のID
+    std::vector<int> probs_; //!< 項目の選択確率
+    int64_t total_prob_ = 0; //!< 選択確率の合計
+
+    mutable std::vector<int64_t> thresholds_; //!< 各列で自身を選ぶ閾値 (total_prob_ を1列の幅とする)
+    mutable std::vector<uint32_t> aliases_; //!< 各列で閾値を超えた場合に選ぶ項目の番号
+    mutable std::vector<uint32_t> work_; //!< 構築用の作業領域 (前から幅が1列に満たない項目、後ろから幅が1列以上ある項目を積む)
+    mutable bool is_built_ = false;
+    mutable bool is_picked_ = false; //!< テーブル構築前に抽選を行ったか
 
-    mutable tl::optional<std::discrete_distribution<>> dist_;
+    /**
+     * @brief エイリアステーブルを構築する
+     *
+     * 各項目の確率を項目数倍して total_prob_ 幅の列に詰め、溢れた分を別の項目 (エイリアス) に割り当てる。
+     * 整数演算のみで行うので、構築後の抽選確率は登録した確率と厳密に一致する。
+     */
+    void build() const
+    {
+        if (is_built_) {
+            return;
+        }
+
+        const auto size = static_cast<uint32_t>(probs_.size());
+        thresholds_.resize(size);
+        aliases_.resize(size);
+        work_.resize(size);
+        uint32_t small_count = 0;
+        auto large_begin = size;
+        for (uint32_t i = 0; i < size; i++) {
+            thresholds_[i] = static_cast<int64_t>(probs_[i]) * size;
+            aliases_[i] = i;
+            if (thresholds_[i] < total_prob_) {
+                work_[small_count++] = i;
+            } else {
+                work_[--large_begin] = i;
+            }
+        }
+
+        while ((small_count > 0) && (large_begin < size)) {
+            const auto small = work_[--small_count];
+            const auto large = work_[large_begin];
+            aliases_[small] = large;
+            thresholds_[large] -= total_prob_ - thresholds_[small];
+            if (thresholds_[large] < total_prob_) {
+                large_begin++;
+                work_[small_count++] = large;
+            }
+        }
+
+        // 整数演算なので残りは必ず幅がちょうど1列分の項目になる
+        for (auto i = large_begin; i < size; i++) {
+            thresholds_[work_[i]] = total_prob_;
+        }
+
+        is_built_ = true;
+    }
+
+    template <typename Rng>
+    IdType pick_linear(Rng &rng) const
+    {
+        std::uniform_int_distribution<uint32_t> dist(0, static_cast<uint32_t>(total_prob_ - 1));
+        auto value = static_cast<int>(dist(rng));
+        for (size_t i = 0; i < probs_.size(); i++) {
+            value -= probs_[i];
+            if (value < 0) {
+                return ids_[i];
+            }
+        }
+
+        return ids_.back();
+    }
+
+    template <typename Rng>
+    IdType pick_built(Rng &rng) const
+    {
+        std::uniform_int_distribution<uint32_t> column_dist(0, static_cast<uint32_t>(ids_.size() - 1));
+        std::uniform_int_distribution<uint32_t> threshold_dist(0, static_cast<uint32_t>(total_prob_ - 1));
+        const auto column = column_dist(rng);
+        const auto index = threshold_dist(rng) < thresholds_[column] ? column : aliases_[column];
+        return ids_[index];
+    }
 };
@@ -1,4 +1,5 @@
 #include "util/rng-xoshiro.h"
+#include <algorithm>
 
 namespace {
 
@@ -99,3 +100,89 @@ const Xoshiro128StarStar::state_type &Xoshiro128StarStar::get_state() const
 {
     return this->rng_state;
 }
+
+/*!
+ * @brief 元となる乱数生成器から引いた値で各系列の内部状態を初期化する
+ *
+ * @param seeder 元となる乱数生成器。系列数×4個の乱数を引くので、その分状態が進む
+ */
+Xoshiro128StarStarLanes::Xoshiro128StarStarLanes(Xoshiro128StarStar &seeder)
+    : buffer_pos(this->buffer.size())
+{
+    for (size_t lane = 0; lane < LANES; lane++) {
+        for (auto &state : this->lane_states) {
+            state[lane] = seeder();
+        }
+
+        // 内部状態が全て0になると以降0しか生成しなくなるので避ける
+        if (std::all_of(this->lane_states.begin(), this->lane_states.end(), [lane](const auto &state) { return state[lane] == 0; })) {
+            this->lane_states[0][lane] = static_cast<uint32_t>(lane + 1);
+        }
+    }
+}
+
+/*!
+ * @brief 次の乱数を生成し、内部状態を更新する
+ *
+ * @return 生成した乱数を返す
+ */
+Xoshiro128StarStarLanes::result_type Xoshiro128StarStarLanes::operator()()
+{
+    if (this->buffer_pos == this->buffer.size()) {
+        for (size_t i = 0; i < BUFFER_ROUNDS; i++) {
+            this->step(&this->buffer[i * LANES]);
+        }
+
+        this->buffer_pos = 0;
+    }
+
+    return this->buffer[this->buffer_pos++];
+}
+
+/*!
+ * @brief 乱数を指定した数だけまとめて生成する
+ *
+ * @param values 生成した乱数を書き込む範囲
+ */
+void Xoshiro128StarStarLanes::generate(std::span<uint32_t> values)
+{
+    auto it = values.begin();
+    while ((it != values.end()) && (this->buffer_pos != this->buffer.size())) {
+        *it++ = this->buffer[this->buffer_pos++];
+    }
+
+    for (; std::distance(it, values.end()) >= static_cast<std::ptrdiff_t>(LANES); it += LANES) {
+        this->step(&*it);
+    }
+
+    for (; it != values.end(); ++it) {
+        *it = (*this)();
+    }
+}
+
+/*!
+ * @brief 全系列を1つずつ進め、系列数分の乱数を生成する
+ * @details 乗算とローテートを系列ごとに独立した固定長のループで書くことで、ループ全体がSIMD化される。
+ *
+ * @param values 生成した乱数を書き込む先 (系列数分の領域が必要)
+ */
+void Xoshiro128StarStarLanes::step(uint32_t *values)
+{
+    // 書き込み先と内部状態が別の領域であるとコンパイラに分かるよう、一旦ローカル変数に生成してから書き込む
+    std::array<uint32_t, LANES> results;
+    auto &[s0, s1, s2, s3] = this->lane_states;
+    for (size_t lane = 0; lane < LANES; lane++) {
+        const uint32_t x = s1[lane] * 5;
+        results[lane] = ((x << 7) | (x >> 25)) * 9;
+
+        const uint32_t t = s1[lane] << 9;
+        s2[lane] ^= s0[lane];
+        s3[lane] ^= s1[lane];
+        s1[lane] ^= s2[lane];
+        s0[lane] ^= s3[lane];
+        s2[lane] ^= t;
+        s3[lane] = (s3[lane] << 11) | (s3[lane] >> 21);
+    }
+
+    std::copy(results.begin(), results.end(), values);
+}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 #ifdef WINDOWS
 // windows.h をインクルードすると min と max マクロが勝手に定義されるという迷惑な仕様があるため、
@@ -42,3 +44,39 @@ public:
 private:
     state_type rng_state; //!< RNG state
 };
+
+/*!
+ * @brief 複数系列の xoshiro128** を並べて同時に進める乱数生成器
+ * @details 各系列の状態を系列ごとではなく状態の要素ごとに並べて保持し、全系列を同じ命令列で進めることで
+ * コンパイラがSIMD命令に置き換えられるようにしている。
+ * 各系列の内部状態は元となる乱数生成器から引いた値で初期化するので、元の乱数生成器の状態が同じならば
+ * 生成される乱数列も同じになる(セーブデータから再開しても再現できる)。
+ */
+class Xoshiro128StarStarLanes {
+public:
+    static constexpr size_t LANES = 8;
+    using result_type = uint32_t;
+
+    explicit Xoshiro128StarStarLanes(Xoshiro128StarStar &seeder);
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+    static constexpr result_type max()
+    {
+        return ~min();
+    }
+
+    result_type operator()();
+    void generate(std::span<uint32_t> values);
+
+private:
+    static constexpr size_t BUFFER_ROUNDS = 8; //!< 1度にバッファへ生成する周回数
+
+    std::array<std::array<uint32_t, LANES>, 4> lane_states; //!< 系列ごとの内部状態 (lane_states[状態の要素][系列])
+    std::array<uint32_t, LANES * BUFFER_ROUNDS> buffer{};
+    size_t buffer_pos;
+
+    void step(uint32_t *values);
+};
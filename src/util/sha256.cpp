@@ -18,6 +18,7 @@
 #include <limits>
 #include <span>
 #include <sstream>
+#include <vector>
 
 namespace util {
 
@@ -74,6 +75,7 @@ namespace {
 
 struct SHA256::Impl {
     void add_length(size_t length);
+    void process_block(std::span<const std::byte, SHA256::BLOCK_SIZE> block);
     void process_message_block();
     void finalize(std::byte pad_byte);
     void pad_message(std::byte pad_byte);
@@ -123,16 +125,36 @@ void SHA256::update(const std::byte *message_array, size_t length)
     this->pimpl->add_length(8 * length);
 
     std::span remain(message_array, length);
-    while (!remain.empty()) {
-        const auto copy_size = std::min<int>(remain.size(), BLOCK_SIZE - this->pimpl->message_block_index);
+    if (this->pimpl->message_block_index > 0) {
+        const auto copy_size = std::min<size_t>(remain.size(), BLOCK_SIZE - this->pimpl->message_block_index);
         std::copy_n(remain.begin(), copy_size, this->pimpl->message_block.begin() + this->pimpl->message_block_index);
-        this->pimpl->message_block_index += copy_size;
+        this->pimpl->message_block_index += static_cast<int>(copy_size);
         remain = remain.subspan(copy_size);
-
-        if (this->pimpl->message_block_index == BLOCK_SIZE) {
-            this->pimpl->process_message_block();
+        if (this->pimpl->message_block_index < BLOCK_SIZE) {
+            return;
         }
+
+        this->pimpl->process_message_block();
     }
+
+    // ブロック境界に揃った部分はバッファへコピーせずに直接処理する
+    while (remain.size() >= BLOCK_SIZE) {
+        this->pimpl->process_block(remain.first<BLOCK_SIZE>());
+        remain = remain.subspan(BLOCK_SIZE);
+    }
+
+    std::copy(remain.begin(), remain.end(), this->pimpl->message_block.begin());
+    this->pimpl->message_block_index = static_cast<int>(remain.size());
+}
+
+/*!
+ * @brief メッセージ(バイト列)をハッシュ値に追加する
+ *
+ * @param message 追加するメッセージ
+ */
+void SHA256::update(std::span<const std::byte> message)
+{
+    this->update(message.data(), message.size());
 }
 
 /*!
@@ -206,7 +228,7 @@ void SHA256::Impl::add_length(size_t len)
     this->length += len;
 }
 
-void SHA256::Impl::process_message_block()
+void SHA256::Impl::process_block(std::span<const std::byte, SHA256::BLOCK_SIZE> block)
 {
     static constexpr std::array<uint32_t, BLOCK_SIZE> k{ {
         // clang-format off
@@ -228,29 +250,44 @@ void SHA256::Impl::process_message_block()
     std::array<uint32_t, BLOCK_SIZE> w{};
 
     for (auto i = 0, i4 = 0; i4 < BLOCK_SIZE; ++i, i4 += 4) {
-        w[i] = (static_cast<uint32_t>(this->message_block[i4]) << 24) |
-               (static_cast<uint32_t>(this->message_block[i4 + 1]) << 16) |
-               (static_cast<uint32_t>(this->message_block[i4 + 2]) << 8) |
-               (static_cast<uint32_t>(this->message_block[i4 + 3]));
+        w[i] = (static_cast<uint32_t>(block[i4]) << 24) |
+               (static_cast<uint32_t>(block[i4 + 1]) << 16) |
+               (static_cast<uint32_t>(block[i4 + 2]) << 8) |
+               (static_cast<uint32_t>(block[i4 + 3]));
     }
 
     for (auto i = 16; i < BLOCK_SIZE; ++i) {
         w[i] = small_sigma1(w[i - 2]) + w[i - 7] + small_sigma0(w[i - 15]) + w[i - 16];
     }
 
-    auto h = this->hash;
-
+    // 作業変数を配列ではなく個別の変数で持ち、ラウンド毎の配列シフトを避ける
+    auto [a, b, c, d, e, f, g, h] = this->hash;
     for (auto i = 0; i < BLOCK_SIZE; ++i) {
-        const auto tmp1 = h[7] + big_sigma1(h[4]) + sha_ch(h[4], h[5], h[6]) + k[i] + w[i];
-        const auto tmp2 = big_sigma0(h[0]) + sha_maj(h[0], h[1], h[2]);
-        std::copy_backward(h.begin(), h.end() - 1, h.end());
-        h[4] += tmp1;
-        h[0] = tmp1 + tmp2;
+        const auto tmp1 = h + big_sigma1(e) + sha_ch(e, f, g) + k[i] + w[i];
+        const auto tmp2 = big_sigma0(a) + sha_maj(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + tmp1;
+        d = c;
+        c = b;
+        b = a;
+        a = tmp1 + tmp2;
     }
 
-    std::transform(this->hash.begin(), this->hash.end(), h.begin(),
-        this->hash.begin(), std::plus<uint32_t>{});
+    this->hash[0] += a;
+    this->hash[1] += b;
+    this->hash[2] += c;
+    this->hash[3] += d;
+    this->hash[4] += e;
+    this->hash[5] += f;
+    this->hash[6] += g;
+    this->hash[7] += h;
+}
 
+void SHA256::Impl::process_message_block()
+{
+    this->process_block(this->message_block);
     this->message_block_index = 0;
 }
 
@@ -298,7 +335,7 @@ tl::optional<SHA256::Digest> SHA256::compute_filehash(const std::filesystem::pat
     }
 
     SHA256 hash;
-    std::array<char, 1024> buf{};
+    std::vector<char> buf(0x10000);
     const auto buf_as_bytes = std::as_bytes(std::span(buf));
     while (ifs) {
         ifs.read(buf.data(), buf.size());
@@ -46,6 +46,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tl/optional.hpp>
@@ -70,6 +71,7 @@ public:
 
     void reset();
     void update(const std::byte *message_array, size_t length);
+    void update(std::span<const std::byte> message);
     void update(std::string_view message);
     void final_bits(std::byte message_bits, size_t length);
     Digest digest();
@@ -0,0 +1,366 @@
+/*!
+ * @file trace.cpp
+ * @brief 処理時間計測用のトレース機能の実装
+ */
+
+#include "util/trace.h"
+
+#ifdef ENABLE_TRACE
+
+#include "locale/japanese.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace trace {
+namespace {
+constexpr size_t MAX_EVENTS = 2000000; //!< Chromeのトレース形式で出力するイベント数の上限. 超えた分は集計にのみ含める
+constexpr uint32_t NO_DETAIL = 0;
+
+using Clock = std::chrono::steady_clock;
+
+/*!
+ * @brief スコープごとの集計
+ */
+struct ScopeStats {
+    int64_t calls = 0;
+    Clock::duration total{};
+    Clock::duration self{}; //!< 内側のスコープの時間を除いた時間
+    Clock::duration max{};
+};
+
+/*!
+ * @brief 値の分布. 2の冪で区切った区間ごとに数える
+ */
+struct Histogram {
+    int64_t samples = 0;
+    int64_t sum = 0;
+    int64_t min = std::numeric_limits<int64_t>::max();
+    int64_t max = std::numeric_limits<int64_t>::min();
+    std::array<int64_t, 65> buckets{}; //!< [0]は0以下、[k]は [2^(k-1), 2^k) の値の数
+};
+
+/*!
+ * @brief Chromeのトレース形式で出力するイベント
+ */
+struct Event {
+    std::string_view name;
+    bool is_counter;
+    uint32_t detail_id; //!< スコープの詳細
+    Clock::time_point time;
+    Clock::duration duration{}; //!< スコープの処理時間
+    int64_t value = 0; //!< カウンタの値
+};
+
+class Tracer {
+public:
+    Tracer(const Tracer &) = delete;
+    Tracer(Tracer &&) = delete;
+    Tracer &operator=(const Tracer &) = delete;
+    Tracer &operator=(Tracer &&) = delete;
+    static Tracer &get_instance();
+
+    uint32_t intern(std::string_view detail);
+    void enter();
+    void leave(std::string_view name, uint32_t detail_id, Clock::time_point start_time);
+    void count(std::string_view name, int64_t value);
+    void record_histogram(std::string_view name, int64_t value);
+
+private:
+    Tracer();
+    ~Tracer();
+
+    Clock::time_point start_time;
+    std::vector<std::string> details{ "" };
+    std::map<std::string, uint32_t, std::less<>> detail_ids;
+    std::vector<Clock::duration> child_times; //!< 計測中のスコープそれぞれについて、内側のスコープにかかった時間
+    std::map<std::pair<std::string_view, uint32_t>, ScopeStats> scopes;
+    std::map<std::string_view, int64_t> counters;
+    std::map<std::string_view, Histogram> histograms;
+    std::vector<Event> events;
+
+    void write_text(std::ostream &os) const;
+    void write_chrome_trace(std::ostream &os) const;
+    int64_t to_us(Clock::time_point time) const;
+};
+
+std::string escape_json(std::string_view str)
+{
+    const auto utf8 = sys_to_utf8(str).value_or("?");
+    std::string escaped;
+    for (const auto ch : utf8) {
+        switch (ch) {
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\\':
+            escaped += "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(ch) < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", ch);
+                escaped += buf;
+            } else {
+                escaped += ch;
+            }
+
+            break;
+        }
+    }
+
+    return escaped;
+}
+
+double to_ms(Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+Tracer &Tracer::get_instance()
+{
+    static Tracer instance;
+    return instance;
+}
+
+Tracer::Tracer()
+    : start_time(Clock::now())
+{
+}
+
+/*!
+ * @brief 終了時に結果を出力する
+ */
+Tracer::~Tracer()
+{
+    const auto *path = std::getenv("ANGBAND_TRACE");
+    if (path == nullptr) {
+        this->write_text(std::cerr);
+        return;
+    }
+
+    std::ofstream ofs(path);
+    if (!ofs) {
+        return;
+    }
+
+    if (std::string_view(path).ends_with(".json")) {
+        this->write_chrome_trace(ofs);
+    } else {
+        this->write_text(ofs);
+    }
+}
+
+uint32_t Tracer::intern(std::string_view detail)
+{
+    const auto it = this->detail_ids.find(detail);
+    if (it != this->detail_ids.end()) {
+        return it->second;
+    }
+
+    const auto detail_id = static_cast<uint32_t>(this->details.size());
+    this->details.emplace_back(detail);
+    this->detail_ids.emplace(detail, detail_id);
+    return detail_id;
+}
+
+void Tracer::enter()
+{
+    this->child_times.push_back({});
+}
+
+void Tracer::leave(std::string_view name, uint32_t detail_id, Clock::time_point start_time)
+{
+    const auto duration = Clock::now() - start_time;
+    const auto self = duration - this->child_times.back();
+    this->child_times.pop_back();
+    if (!this->child_times.empty()) {
+        this->child_times.back() += duration;
+    }
+
+    const auto add_stats = [&](uint32_t id) {
+        auto &stats = this->scopes[{ name, id }];
+        stats.calls++;
+        stats.total += duration;
+        stats.self += self;
+        stats.max = std::max(stats.max, duration);
+    };
+    add_stats(NO_DETAIL);
+    if (detail_id != NO_DETAIL) {
+        add_stats(detail_id);
+    }
+
+    if (this->events.size() < MAX_EVENTS) {
+        this->events.push_back({ name, false, detail_id, start_time, duration });
+    }
+}
+
+void Tracer::count(std::string_view name, int64_t value)
+{
+    auto &counter = this->counters[name];
+    counter += value;
+    if (this->events.size() < MAX_EVENTS) {
+        this->events.push_back({ name, true, NO_DETAIL, Clock::now(), {}, counter });
+    }
+}
+
+void Tracer::record_histogram(std::string_view name, int64_t value)
+{
+    auto &histogram = this->histograms[name];
+    histogram.samples++;
+    histogram.sum += value;
+    histogram.min = std::min(histogram.min, value);
+    histogram.max = std::max(histogram.max, value);
+    const auto bucket = (value <= 0) ? 0 : std::bit_width(static_cast<uint64_t>(value));
+    histogram.buckets[bucket]++;
+}
+
+int64_t Tracer::to_us(Clock::time_point time) const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - this->start_time).count();
+}
+
+/*!
+ * @brief 集計結果をテキストで出力する
+ * @details スコープは合計時間の長い順に並べ、詳細ごとの集計をその下に字下げして続ける.
+ */
+void Tracer::write_text(std::ostream &os) const
+{
+    std::vector<std::pair<std::string_view, const ScopeStats *>> totals;
+    std::map<std::string_view, std::vector<std::pair<uint32_t, const ScopeStats *>>> details_by_name;
+    for (const auto &[key, stats] : this->scopes) {
+        if (key.second == NO_DETAIL) {
+            totals.emplace_back(key.first, &stats);
+        } else {
+            details_by_name[key.first].emplace_back(key.second, &stats);
+        }
+    }
+
+    const auto by_total = [](const auto &a, const auto &b) { return a.second->total > b.second->total; };
+    std::sort(totals.begin(), totals.end(), by_total);
+    const auto write_stats = [&os](std::string_view label, const ScopeStats &stats) {
+        char buf[256];
+        std::snprintf(buf, sizeof(buf), "%12lld %12.3f %12.3f %10.3f %10.3f  ", static_cast<long long>(stats.calls), to_ms(stats.total), to_ms(stats.self),
+            1000.0 * to_ms(stats.total) / stats.calls, 1000.0 * to_ms(stats.max));
+        os << buf << label << '\n';
+    };
+
+    os << "elapsed: " << to_ms(Clock::now() - this->start_time) << " ms\n";
+    os << "       calls     total ms      self ms    mean us     max us  scope\n";
+    for (const auto &[name, stats] : totals) {
+        write_stats(name, *stats);
+        auto it = details_by_name.find(name);
+        if (it == details_by_name.end()) {
+            continue;
+        }
+
+        auto &details = it->second;
+        std::sort(details.begin(), details.end(), by_total);
+        for (const auto &[detail_id, detail_stats] : details) {
+            write_stats(std::string("    ").append(this->details[detail_id]), *detail_stats);
+        }
+    }
+
+    if (!this->counters.empty()) {
+        os << "counters:\n";
+        for (const auto &[name, value] : this->counters) {
+            os << "  " << name << ": " << value << '\n';
+        }
+    }
+
+    for (const auto &[name, histogram] : this->histograms) {
+        os << "histogram " << name << ": samples " << histogram.samples << ", mean " << (static_cast<double>(histogram.sum) / histogram.samples);
+        os << ", min " << histogram.min << ", max " << histogram.max << '\n';
+        for (size_t i = 0; i < histogram.buckets.size(); i++) {
+            if (histogram.buckets[i] == 0) {
+                continue;
+            }
+
+            if (i == 0) {
+                os << "  <= 0: ";
+            } else {
+                os << "  [" << (uint64_t{ 1 } << (i - 1)) << ", " << ((i < 64) ? std::to_string(uint64_t{ 1 } << i) : "inf") << "): ";
+            }
+
+            os << histogram.buckets[i] << '\n';
+        }
+    }
+}
+
+/*!
+ * @brief Chromeのトレース形式 (Trace Event Format) で出力する
+ * @details スコープは Complete イベント、カウンタは Counter イベントとする. 上限を超えたイベントは出力しない.
+ */
+void Tracer::write_chrome_trace(std::ostream &os) const
+{
+    std::vector<std::string> escaped_details;
+    for (const auto &detail : this->details) {
+        escaped_details.push_back(escape_json(detail));
+    }
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    auto is_first = true;
+    for (const auto &event : this->events) {
+        if (!is_first) {
+            os << ",\n";
+        }
+
+        is_first = false;
+        os << "{\"name\":\"" << escape_json(event.name) << "\",\"pid\":1,\"tid\":1,\"ts\":" << this->to_us(event.time);
+        if (event.is_counter) {
+            os << ",\"ph\":\"C\",\"args\":{\"value\":" << event.value << "}}";
+            continue;
+        }
+
+        os << ",\"ph\":\"X\",\"dur\":" << std::chrono::duration_cast<std::chrono::microseconds>(event.duration).count();
+        if (event.detail_id != NO_DETAIL) {
+            os << ",\"args\":{\"detail\":\"" << escaped_details[event.detail_id] << "\"}";
+        }
+
+        os << '}';
+    }
+
+    os << "\n]}\n";
+}
+}
+
+Scope::Scope(std::string_view name)
+    : Scope(name, std::string_view())
+{
+}
+
+Scope::Scope(std::string_view name, std::string_view detail)
+    : name(name)
+    , detail_id(detail.empty() ? NO_DETAIL : Tracer::get_instance().intern(detail))
+{
+    Tracer::get_instance().enter();
+    this->start_time = Clock::now();
+}
+
+Scope::~Scope()
+{
+    Tracer::get_instance().leave(this->name, this->detail_id, this->start_time);
+}
+
+void count(std::string_view name, int64_t value)
+{
+    Tracer::get_instance().count(name, value);
+}
+
+void record_histogram(std::string_view name, int64_t value)
+{
+    Tracer::get_instance().record_histogram(name, value);
+}
+}
+
+#endif
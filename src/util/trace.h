@@ -0,0 +1,62 @@
+#pragma once
+
+/*!
+ * @file trace.h
+ * @brief 処理時間計測用のトレース機能
+ * @details ENABLE_TRACE を定義してビルドした時 (configure --enable-trace) だけ有効になり、無効の時は各マクロが何も生成しない.
+ * 終了時に環境変数 ANGBAND_TRACE で指定したファイルへ結果を出力する (未指定なら標準エラー出力).
+ * 拡張子が .json ならばChromeのトレース形式 (chrome://tracing や Perfetto で読める)、それ以外ならば集計結果のテキストとなる.
+ * - TRACE_SCOPE(name): スコープの処理時間を計測する. 入れ子にしてもよい
+ * - TRACE_SCOPE_DETAIL(name, detail): TRACE_SCOPE に加え、detail (文字列) ごとにも集計する
+ * - TRACE_COUNT(name, value): カウンタに値を加算する
+ * - TRACE_HISTOGRAM(name, value): 値の分布を記録する
+ * name には文字列リテラルを与えること. 無効の時は引数が評価されないので、副作用のある式を与えてはならない.
+ */
+
+#include "system/h-basic.h" // ENABLE_TRACE は autoconf.h で定義される.
+
+#ifdef ENABLE_TRACE
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+namespace trace {
+/*!
+ * @brief スコープの処理時間を計測する
+ */
+class Scope {
+public:
+    explicit Scope(std::string_view name);
+    Scope(std::string_view name, std::string_view detail);
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope(Scope &&) = delete;
+    Scope &operator=(const Scope &) = delete;
+    Scope &operator=(Scope &&) = delete;
+
+private:
+    std::string_view name;
+    uint32_t detail_id;
+    std::chrono::steady_clock::time_point start_time;
+};
+
+void count(std::string_view name, int64_t value);
+void record_histogram(std::string_view name, int64_t value);
+}
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SCOPE(name) const trace::Scope TRACE_CONCAT(trace_scope_, __LINE__)(name)
+#define TRACE_SCOPE_DETAIL(name, detail) const trace::Scope TRACE_CONCAT(trace_scope_, __LINE__)(name, detail)
+#define TRACE_COUNT(name, value) trace::count(name, value)
+#define TRACE_HISTOGRAM(name, value) trace::record_histogram(name, value)
+
+#else
+
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#define TRACE_SCOPE_DETAIL(name, detail) static_cast<void>(0)
+#define TRACE_COUNT(name, value) static_cast<void>(0)
+#define TRACE_HISTOGRAM(name, value) static_cast<void>(0)
+
+#endif
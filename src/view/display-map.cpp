@@ -1,6 +1,6 @@
 #include "view/display-map.h"
-#include "autopick/autopick-finder.h"
 #include "autopick/autopick-methods-table.h"
+#include "autopick/autopick-rule-index.h"
 #include "autopick/autopick-util.h"
 #include "game-option/map-screen-options.h"
 #include "game-option/special-options.h"
@@ -143,74 +143,55 @@ DisplaySymbolPair map_info(PlayerType *player_ptr, const Pos2D &pos)
     const auto is_darkened = !has_nocto && grid.is_darkened();
     const auto tag_unsafe = (view_unsafe_grids && (grid.info & CAVE_UNSAFE)) ? TerrainTag::UNDETECTED : TerrainTag::NONE;
     const auto *terrain_mimic_ptr = &grid.get_terrain(TerrainKind::MIMIC);
-    DisplaySymbol symbol_config;
+    auto lighting_level = F_LIT_STANDARD;
     if (terrain_mimic_ptr->flags.has_not(TerrainCharacteristics::REMEMBER)) {
         const auto is_visible = any_bits(grid.info, (CAVE_MARK | CAVE_LITE | CAVE_MNLT));
         const auto is_glowing = match_bits(grid.info, CAVE_GLOW | CAVE_MNDK, CAVE_GLOW);
         const auto can_view = grid.is_view() && (is_glowing || has_nocto);
-        if (!is_blind && (is_visible || can_view)) {
-            symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_STANDARD);
-            if (is_wild_mode) {
-                if (view_special_lite && !world.is_daytime()) {
-                    symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                }
-            } else if (is_darkened) {
-                terrain_mimic_ptr = &terrains.get_terrain(tag_unsafe);
-                symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_STANDARD);
-            } else if (view_special_lite) {
-                if (grid.info & (CAVE_LITE | CAVE_MNLT)) {
-                    if (view_yellow_lite) {
-                        symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_LITE);
-                    }
-                } else if ((grid.info & (CAVE_GLOW | CAVE_MNDK)) != CAVE_GLOW) {
-                    symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                } else if (!(grid.info & CAVE_VIEW)) {
-                    if (view_bright_lite) {
-                        symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                    }
-                }
+        if (is_blind || (!is_visible && !can_view)) {
+            terrain_mimic_ptr = &terrains.get_terrain(tag_unsafe);
+        } else if (is_wild_mode) {
+            if (view_special_lite && !world.is_daytime()) {
+                lighting_level = F_LIT_DARK;
             }
-        } else {
+        } else if (is_darkened) {
             terrain_mimic_ptr = &terrains.get_terrain(tag_unsafe);
-            symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_STANDARD);
-        }
-    } else {
-        if (grid.is_mark() && is_revealed_wall(floor, pos)) {
-            symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_STANDARD);
-            if (is_wild_mode) {
-                if (view_granite_lite && (is_blind || !world.is_daytime())) {
-                    symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                }
-            } else if (is_darkened && !is_blind) {
-                if (terrain_mimic_ptr->flags.has_all_of({ TerrainCharacteristics::LOS, TerrainCharacteristics::PROJECTION })) {
-                    terrain_mimic_ptr = &terrains.get_terrain(tag_unsafe);
-                    symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_STANDARD);
-                } else if (view_granite_lite && view_bright_lite) {
-                    symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                }
-            } else if (view_granite_lite) {
-                if (is_blind) {
-                    symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                } else if (grid.info & (CAVE_LITE | CAVE_MNLT)) {
-                    if (view_yellow_lite) {
-                        symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_LITE);
-                    }
-                } else if (view_bright_lite) {
-                    if (!(grid.info & CAVE_VIEW)) {
-                        symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                    } else if ((grid.info & (CAVE_GLOW | CAVE_MNDK)) != CAVE_GLOW) {
-                        symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                    } else if (terrain_mimic_ptr->flags.has_not(TerrainCharacteristics::LOS) && !floor.is_illuminated_at(player_ptr->get_position(), pos)) {
-                        symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_DARK);
-                    }
-                }
+        } else if (view_special_lite) {
+            if (grid.info & (CAVE_LITE | CAVE_MNLT)) {
+                lighting_level = view_yellow_lite ? F_LIT_LITE : F_LIT_STANDARD;
+            } else if (!is_glowing) {
+                lighting_level = F_LIT_DARK;
+            } else if (!(grid.info & CAVE_VIEW)) {
+                lighting_level = view_bright_lite ? F_LIT_DARK : F_LIT_STANDARD;
             }
-        } else {
+        }
+    } else if (!grid.is_mark() || !is_revealed_wall(floor, pos)) {
+        terrain_mimic_ptr = &terrains.get_terrain(tag_unsafe);
+    } else if (is_wild_mode) {
+        if (view_granite_lite && (is_blind || !world.is_daytime())) {
+            lighting_level = F_LIT_DARK;
+        }
+    } else if (is_darkened && !is_blind) {
+        if (terrain_mimic_ptr->flags.has_all_of({ TerrainCharacteristics::LOS, TerrainCharacteristics::PROJECTION })) {
             terrain_mimic_ptr = &terrains.get_terrain(tag_unsafe);
-            symbol_config = terrain_mimic_ptr->symbol_configs.at(F_LIT_STANDARD);
+        } else if (view_granite_lite && view_bright_lite) {
+            lighting_level = F_LIT_DARK;
+        }
+    } else if (view_granite_lite) {
+        if (is_blind) {
+            lighting_level = F_LIT_DARK;
+        } else if (grid.info & (CAVE_LITE | CAVE_MNLT)) {
+            lighting_level = view_yellow_lite ? F_LIT_LITE : F_LIT_STANDARD;
+        } else if (view_bright_lite) {
+            if (!(grid.info & CAVE_VIEW) || !match_bits(grid.info, CAVE_GLOW | CAVE_MNDK, CAVE_GLOW)) {
+                lighting_level = F_LIT_DARK;
+            } else if (terrain_mimic_ptr->flags.has_not(TerrainCharacteristics::LOS) && !floor.is_illuminated_at(player_ptr->get_position(), pos)) {
+                lighting_level = F_LIT_DARK;
+            }
         }
     }
 
+    auto symbol_config = terrain_mimic_ptr->symbol_configs[lighting_level];
     if (feat_priority == -1) {
         feat_priority = terrain_mimic_ptr->priority;
     }
@@ -228,7 +209,7 @@ DisplaySymbolPair map_info(PlayerType *player_ptr, const Pos2D &pos)
         }
 
         if (display_autopick) {
-            match_autopick = find_autopick_list(player_ptr, &item);
+            match_autopick = AutopickRuleIndex::get_instance().find_cached(player_ptr, item);
             if (match_autopick == -1) {
                 continue;
             }
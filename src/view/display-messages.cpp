@@ -30,6 +30,9 @@ namespace {
 /*! 表示するメッセージの先頭位置 */
 static int msg_head_pos = 0;
 
+/*! メッセージ履歴の変更回数 */
+uint32_t message_history_revision = 0;
+
 using msg_sp = std::shared_ptr<const std::string>;
 using msg_wp = std::weak_ptr<const std::string>;
 
@@ -93,6 +96,15 @@ int32_t message_num(void)
     return message_history.size();
 }
 
+/*!
+ * @brief メッセージ履歴の変更回数を返す
+ * @return 変更回数. 履歴の内容が変わっていなければ前回と同じ値を返す
+ */
+uint32_t message_revision()
+{
+    return message_history_revision;
+}
+
 /*!
  * @brief 過去のゲームメッセージを返す。 / Recall the "text" of a saved message
  * @param age メッセージの世代
@@ -122,6 +134,7 @@ void message_add(std::string_view msg)
         return;
     }
 
+    message_history_revision++;
     if (!message_history.empty()) {
         auto &last_msg = message_history.front();
 
@@ -377,6 +390,7 @@ void wr_message_history()
 void rd_message_history()
 {
     message_history.clear();
+    message_history_revision++;
 
     const auto message_hisotry_num = rd_s32b();
     for (auto i = 0; i < message_hisotry_num; i++) {
@@ -36,6 +36,7 @@
 #include "target/target-preparation.h"
 #include "term/gameterm.h"
 #include "term/screen-processor.h"
+#include "term/z-term.h"
 #include "timed-effect/timed-effects.h"
 #include "tracking/lore-tracker.h"
 #include "util/buffer-shaper.h"
@@ -50,10 +51,13 @@
 #include "window/main-window-util.h"
 #include "world/world.h"
 #include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstdint>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <tl/optional.hpp>
 
 /*! サブウィンドウ表示用の ItemTester オブジェクト */
 static std::unique_ptr<ItemTester> fix_item_tester = std::make_unique<AllMatchItemTester>();
@@ -68,19 +72,39 @@ FixItemTesterSetter::~FixItemTesterSetter()
     fix_item_tester = std::make_unique<AllMatchItemTester>();
 }
 
+/*!
+ * @brief サブウィンドウに最後に表示した内容
+ */
+struct SubWindowContent {
+    SubWindowRedrawingFlag flag; //!< 表示したウィンドウの種類
+    tl::optional<uint64_t> key; //!< 表示内容を決める値のハッシュ. 描画してみないと分からない場合はnullopt
+    std::unique_ptr<term_win> screen; //!< 表示した画面
+};
+
+/*! サブウィンドウごとの最後に表示した内容 */
+static std::array<tl::optional<SubWindowContent>, MAX_WINDOW_ENTITIES> sub_window_contents;
+
+static uint64_t hash_combine(uint64_t seed, uint64_t value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
 /*!
  * @brief サブウィンドウの描画を行う
  *
  * pw_flag で指定したウィンドウフラグが設定されているサブウィンドウに対し描画を行う。
  * 描画は display_func で指定したコールバック関数で行う。
+ * get_content_key が返す値が前回の描画時と同じで、その後画面が書き換えられていなければ描画を省略する。
+ * 描画しても画面が前回と変わらなければ term_fresh() を省略する。
  *
  * @param pw_flag 描画を行うフラグ
+ * @param get_content_key 表示内容を決める値のハッシュを返す関数. 表示内容が前回と同じか事前に分からなければnulloptを返す
  * @param display_func 描画を行う関数
  */
-static void display_sub_windows(SubWindowRedrawingFlag pw_flag, std::invocable auto display_func)
+static void display_sub_windows(SubWindowRedrawingFlag pw_flag, std::invocable auto get_content_key, std::invocable auto display_func)
 {
     auto current_term = game_term;
-
+    tl::optional<tl::optional<uint64_t>> content_key;
     for (auto i = 0U; i < angband_terms.size(); ++i) {
         auto term = angband_terms[i];
         if (term == nullptr) {
@@ -91,14 +115,45 @@ static void display_sub_windows(SubWindowRedrawingFlag pw_flag, std::invocable a
             continue;
         }
 
+        if (!content_key) {
+            content_key = get_content_key();
+        }
+
         term_activate(term);
+        auto &content = sub_window_contents[i];
+        const auto is_intact = content && !game_term->total_erase && content->screen->has_same_screen(*game_term->scr);
+        if (is_intact && *content_key && (content->flag == pw_flag) && (content->key == *content_key)) {
+            continue;
+        }
+
         display_func();
-        term_fresh();
+        if (!is_intact || !content->screen->has_same_screen(*game_term->scr)) {
+            term_fresh();
+        }
+
+        if (content) {
+            content->flag = pw_flag;
+            content->key = *content_key;
+            *content->screen = *game_term->scr;
+        } else {
+            content = SubWindowContent{ pw_flag, *content_key, game_term->scr->clone() };
+        }
     }
 
     term_activate(current_term);
 }
 
+/*!
+ * @brief サブウィンドウの描画を行う
+ * @param pw_flag 描画を行うフラグ
+ * @param display_func 描画を行う関数
+ * @details 表示内容が前回と同じかを事前には調べず、必ず描画する.
+ */
+static void display_sub_windows(SubWindowRedrawingFlag pw_flag, std::invocable auto display_func)
+{
+    display_sub_windows(pw_flag, [] { return tl::optional<uint64_t>(); }, display_func);
+}
+
 /*!
  * @brief サブウィンドウに所持品一覧を表示する / Hack -- display inventory in sub-windows
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -261,6 +316,33 @@ static void print_pet_list(PlayerType *player_ptr, const std::vector<MONSTER_IDX
     }
 }
 
+/*!
+ * @brief モンスターの出現リストの表示内容を決める値のハッシュを求める
+ * @details print_monster_list() が表示に用いる値だけを対象とする.
+ */
+static uint64_t calc_monster_list_key(const FloorType &floor, const std::vector<MONSTER_IDX> &monster_list)
+{
+    uint64_t key = monster_list.size();
+    for (const auto monster_index : monster_list) {
+        const auto &monster = floor.m_list[monster_index];
+        const auto is_listed = !monster.is_pet() && monster.is_valid();
+        key = hash_combine(key, is_listed);
+        if (!is_listed) {
+            continue;
+        }
+
+        const auto &monrace = monster.get_appearance_monrace();
+        key = hash_combine(key, static_cast<uint64_t>(monster.ap_r_idx));
+        key = hash_combine(key, monster.is_asleep());
+        key = hash_combine(key, monster.mflag2.has(MonsterConstantFlagType::KAGE));
+        key = hash_combine(key, monrace.r_tkills > 0);
+        key = hash_combine(key, monrace.is_bounty(true));
+        key = hash_combine(key, (monrace.symbol_config.color << 8) | static_cast<uint8_t>(monrace.symbol_config.character));
+    }
+
+    return key;
+}
+
 /*!
  * @brief 出現中モンスターのリストをサブウィンドウに表示する / Hack -- display monster list in sub-windows
  * @param player_ptr プレイヤーへの参照ポインタ
@@ -272,8 +354,11 @@ void fix_monster_list(PlayerType *player_ptr)
 
     display_sub_windows(SubWindowRedrawingFlag::SIGHT_MONSTERS,
         [player_ptr, &once] {
-            const auto &[wid, hgt] = term_get_size();
             std::call_once(once, target_sensing_monsters_prepare, player_ptr, monster_list);
+            return tl::make_optional(calc_monster_list_key(*player_ptr->current_floor_ptr, monster_list));
+        },
+        [player_ptr] {
+            const auto &[wid, hgt] = term_get_size();
             print_monster_list(*player_ptr->current_floor_ptr, monster_list, 0, 0, hgt);
         });
 
@@ -405,6 +490,9 @@ void fix_player(PlayerType *player_ptr)
 void fix_message(void)
 {
     display_sub_windows(SubWindowRedrawingFlag::MESSAGE,
+        [] {
+            return tl::make_optional(hash_combine(message_revision(), now_message));
+        },
         [] {
             const auto &[wid, hgt] = term_get_size();
 
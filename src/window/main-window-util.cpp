@@ -18,6 +18,7 @@
 #include "timed-effect/timed-effects.h"
 #include "view/display-map.h"
 #include "view/display-symbol.h"
+#include "window/overhead-map-cache.h"
 #include "world/world.h"
 #include <string>
 #include <string_view>
@@ -76,6 +77,7 @@ void print_map(PlayerType *player_ptr)
 
     const auto v = term_get_cursor();
     term_set_cursor(false);
+    OverheadMapCache::get_instance().set_all_dirty();
 
     const auto &floor = *player_ptr->current_floor_ptr;
     POSITION xmin = (0 < panel_col_min) ? panel_col_min : 0;
@@ -153,10 +155,6 @@ static void display_shortened_item_name(PlayerType *player_ptr, const ItemEntity
  */
 void display_map(PlayerType *player_ptr, int *cy, int *cx)
 {
-    int i, j, x, y;
-
-    byte tp;
-
     bool old_view_special_lite = view_special_lite;
     bool old_view_granite_lite = view_granite_lite;
 
@@ -168,102 +166,31 @@ void display_map(PlayerType *player_ptr, int *cy, int *cx)
         wid = wid / 2 - 1;
     }
 
-    const auto &floor = *player_ptr->current_floor_ptr;
-    const auto yrat = (floor.height + hgt - 1) / hgt;
-    const auto xrat = (floor.width + wid - 1) / wid;
     view_special_lite = false;
     view_granite_lite = false;
 
-    using std::vector;
-    vector<vector<TERM_COLOR>> ma(hgt + 2, vector<TERM_COLOR>(wid + 2, TERM_WHITE));
-    vector<vector<char>> mc(hgt + 2, vector<char>(wid + 2, ' '));
-    vector<vector<byte>> mp(hgt + 2, vector<byte>(wid + 2, 0));
-    vector<vector<int>> match_autopick_yx(hgt + 2, vector<int>(wid + 2, -1));
-    vector<vector<const ItemEntity *>> object_autopick_yx(hgt + 2, vector<const ItemEntity *>(wid + 2, nullptr));
-
-    vector<vector<TERM_COLOR>> bigma(floor.height + 2, vector<TERM_COLOR>(floor.width + 2, TERM_WHITE));
-    vector<vector<char>> bigmc(floor.height + 2, vector<char>(floor.width + 2, ' '));
-    vector<vector<byte>> bigmp(floor.height + 2, vector<byte>(floor.width + 2, 0));
-
-    for (i = 0; i < floor.width; ++i) {
-        for (j = 0; j < floor.height; ++j) {
-            x = i / xrat + 1;
-            y = j / yrat + 1;
-
-            match_autopick = -1;
-            autopick_obj = nullptr;
-            feat_priority = -1;
-            const auto symbol_pair = map_info(player_ptr, { j, i });
-            tp = (byte)feat_priority;
-            if (match_autopick != -1 && (match_autopick_yx[y][x] == -1 || match_autopick_yx[y][x] > match_autopick)) {
-                match_autopick_yx[y][x] = match_autopick;
-                object_autopick_yx[y][x] = autopick_obj;
-                tp = 0x7f;
-            }
-
-            bigma[j + 1][i + 1] = symbol_pair.symbol_foreground.color;
-            bigmc[j + 1][i + 1] = symbol_pair.symbol_foreground.character;
-            bigmp[j + 1][i + 1] = tp;
-        }
-    }
-
-    for (j = 0; j < floor.height; ++j) {
-        for (i = 0; i < floor.width; ++i) {
-            x = i / xrat + 1;
-            y = j / yrat + 1;
-
-            DisplaySymbol symbol_foreground(bigma[j + 1][i + 1], bigmc[j + 1][i + 1]);
-            tp = bigmp[j + 1][i + 1];
-            if (mp[y][x] == tp) {
-                int cnt = 0;
-
-                for (const auto &d : Direction::directions_8()) {
-                    const auto vec = d.vec();
-                    if ((symbol_foreground.character == bigmc[j + 1 + vec.y][i + 1 + vec.x]) && (symbol_foreground.color == bigma[j + 1 + vec.y][i + 1 + vec.x])) {
-                        cnt++;
-                    }
-                }
-                if (cnt <= 4) {
-                    tp++;
-                }
-            }
-
-            if (mp[y][x] < tp) {
-                ma[y][x] = symbol_foreground.color;
-                mc[y][x] = symbol_foreground.character;
-                mp[y][x] = tp;
-            }
-        }
-    }
-
-    x = wid + 1;
-    y = hgt + 1;
-
-    mc[0][0] = mc[0][x] = mc[y][0] = mc[y][x] = '+';
-    for (x = 1; x <= wid; x++) {
-        mc[0][x] = mc[y][x] = '-';
-    }
-
-    for (y = 1; y <= hgt; y++) {
-        mc[y][0] = mc[y][x] = '|';
-    }
+    auto &overhead_map = OverheadMapCache::get_instance();
+    overhead_map.update(player_ptr, wid, hgt);
+    const auto yrat = overhead_map.get_y_ratio();
+    const auto xrat = overhead_map.get_x_ratio();
 
-    for (y = 0; y < hgt + 2; ++y) {
+    for (auto y = 0; y < hgt + 2; ++y) {
         term_gotoxy(COL_MAP, y);
-        for (x = 0; x < wid + 2; ++x) {
-            DisplaySymbol symbol_foreground(ma[y][x], mc[y][x]);
+        for (auto x = 0; x < wid + 2; ++x) {
+            auto symbol_foreground = overhead_map.get_symbol(y, x);
             symbol_foreground.color = get_monochrome_display_color(player_ptr).value_or(symbol_foreground.color);
 
             term_add_bigch(symbol_foreground);
         }
     }
 
-    for (y = 1; y < hgt + 1; ++y) {
+    for (auto y = 1; y < hgt + 1; ++y) {
         match_autopick = -1;
-        for (x = 1; x <= wid; x++) {
-            if (match_autopick_yx[y][x] != -1 && (match_autopick > match_autopick_yx[y][x] || match_autopick == -1)) {
-                match_autopick = match_autopick_yx[y][x];
-                autopick_obj = object_autopick_yx[y][x];
+        for (auto x = 1; x <= wid; x++) {
+            const auto match = overhead_map.get_match_autopick(y, x);
+            if (match != -1 && (match_autopick > match || match_autopick == -1)) {
+                match_autopick = match;
+                autopick_obj = overhead_map.get_autopick_item(y, x);
             }
         }
 
@@ -0,0 +1,314 @@
+/*!
+ * @file overhead-map-cache.cpp
+ * @brief 縮小マップの表示内容のキャッシュの実装
+ */
+
+#include "window/overhead-map-cache.h"
+#include "floor/geometry.h"
+#include "game-option/special-options.h"
+#include "player/player-status.h"
+#include "system/floor/floor-info.h"
+#include "system/player-type-definition.h"
+#include "system/redrawing-flags-updater.h"
+#include "term/term-color-types.h"
+#include "timed-effect/player-hallucination.h"
+#include "timed-effect/timed-effects.h"
+#include "view/display-map.h"
+#include "window/main-window-util.h"
+#include <algorithm>
+
+OverheadMapCache &OverheadMapCache::get_instance()
+{
+    static OverheadMapCache instance;
+    return instance;
+}
+
+/*!
+ * @brief グリッドの表示が変わったことを通知する
+ * @param pos 表示の変わったグリッドの座標
+ */
+void OverheadMapCache::set_dirty(const Pos2D &pos)
+{
+    if (this->is_all_dirty) {
+        return;
+    }
+
+    if ((pos.y < 0) || (pos.y >= this->floor_height) || (pos.x < 0) || (pos.x >= this->floor_width)) {
+        return;
+    }
+
+    const auto index = this->grid_index(pos.y, pos.x);
+    if (this->is_dirty_grids[index]) {
+        return;
+    }
+
+    // 変化が多い時はまとめて計算し直す方が速い.
+    if (std::ssize(this->dirty_positions) >= this->floor_width * this->floor_height / 4) {
+        this->set_all_dirty();
+        return;
+    }
+
+    this->is_dirty_grids[index] = true;
+    this->dirty_positions.push_back(pos);
+}
+
+/*!
+ * @brief フロア全体の表示が変わったことを通知する
+ */
+void OverheadMapCache::set_all_dirty()
+{
+    this->is_all_dirty = true;
+    for (const auto &pos : this->dirty_positions) {
+        this->is_dirty_grids[this->grid_index(pos.y, pos.x)] = false;
+    }
+
+    this->dirty_positions.clear();
+}
+
+/*!
+ * @brief 縮小マップの表示内容を最新の状態にする
+ * @param player_ptr プレイヤーへの参照ポインタ
+ * @param wid 縮小マップの桁数 (枠線を除く)
+ * @param hgt 縮小マップの行数 (枠線を除く)
+ */
+void OverheadMapCache::update(PlayerType *player_ptr, int wid, int hgt)
+{
+    const auto &floor = *player_ptr->current_floor_ptr;
+    if ((floor.width != this->floor_width) || (floor.height != this->floor_height) || (wid != this->wid) || (hgt != this->hgt)) {
+        this->resize(floor.width, floor.height, wid, hgt);
+    }
+
+    if (this->display_autopick != ::display_autopick) {
+        this->display_autopick = ::display_autopick;
+        this->set_all_dirty();
+    }
+
+    const auto is_map_redrawing = RedrawingFlagsUpdater::get_instance().has(MainWindowRedrawingFlag::MAP);
+    if (is_map_redrawing || player_ptr->effects()->hallucination().is_hallucinated()) {
+        this->set_all_dirty();
+    }
+
+    if (this->is_all_dirty) {
+        for (auto y = 0; y < this->floor_height; y++) {
+            for (auto x = 0; x < this->floor_width; x++) {
+                this->update_grid(player_ptr, { y, x });
+            }
+        }
+
+        for (auto y = 1; y <= this->hgt; y++) {
+            for (auto x = 1; x <= this->wid; x++) {
+                this->update_cell(y, x);
+            }
+        }
+
+        this->is_all_dirty = false;
+        return;
+    }
+
+    if (this->dirty_positions.empty()) {
+        return;
+    }
+
+    std::vector<Pos2D> dirty_cells;
+    for (const auto &pos : this->dirty_positions) {
+        this->is_dirty_grids[this->grid_index(pos.y, pos.x)] = false;
+        this->update_grid(player_ptr, pos);
+
+        // 縮小マップのマスの計算では周囲8グリッドの表示も参照する.
+        for (auto dy = -1; dy <= 1; dy++) {
+            for (auto dx = -1; dx <= 1; dx++) {
+                const Pos2D pos_neighbor(pos.y + dy, pos.x + dx);
+                if ((pos_neighbor.y < 0) || (pos_neighbor.y >= this->floor_height) || (pos_neighbor.x < 0) || (pos_neighbor.x >= this->floor_width)) {
+                    continue;
+                }
+
+                const Pos2D pos_cell(pos_neighbor.y / this->yrat + 1, pos_neighbor.x / this->xrat + 1);
+                const auto index = this->cell_index(pos_cell.y, pos_cell.x);
+                if (!this->is_dirty_cells[index]) {
+                    this->is_dirty_cells[index] = true;
+                    dirty_cells.push_back(pos_cell);
+                }
+            }
+        }
+    }
+
+    this->dirty_positions.clear();
+    for (const auto &pos_cell : dirty_cells) {
+        this->is_dirty_cells[this->cell_index(pos_cell.y, pos_cell.x)] = false;
+        this->update_cell(pos_cell.y, pos_cell.x);
+    }
+}
+
+int OverheadMapCache::get_y_ratio() const
+{
+    return this->yrat;
+}
+
+int OverheadMapCache::get_x_ratio() const
+{
+    return this->xrat;
+}
+
+/*!
+ * @brief 縮小マップのマスの表示内容を得る
+ * @param y 縮小マップの行 (0と hgt + 1 は枠線)
+ * @param x 縮小マップの桁 (0と wid + 1 は枠線)
+ * @return 表示する文字と色
+ */
+const DisplaySymbol &OverheadMapCache::get_symbol(int y, int x) const
+{
+    return this->symbols[this->cell_index(y, x)];
+}
+
+/*!
+ * @brief 縮小マップのマスに含まれるアイテムに一致した自動拾いのエントリを得る
+ * @param y 縮小マップの行
+ * @param x 縮小マップの桁
+ * @return 一致したエントリのうち最も若い番号. なければ-1
+ */
+int OverheadMapCache::get_match_autopick(int y, int x) const
+{
+    return this->match_autopicks[this->cell_index(y, x)];
+}
+
+/*!
+ * @brief 縮小マップのマスに含まれる、自動拾いのエントリに一致したアイテムを得る
+ * @param y 縮小マップの行
+ * @param x 縮小マップの桁
+ * @return get_match_autopick() のエントリに一致したアイテム. なければnullptr
+ */
+const ItemEntity *OverheadMapCache::get_autopick_item(int y, int x) const
+{
+    return this->autopick_items[this->cell_index(y, x)];
+}
+
+void OverheadMapCache::resize(int floor_width, int floor_height, int wid, int hgt)
+{
+    this->floor_width = floor_width;
+    this->floor_height = floor_height;
+    this->wid = wid;
+    this->hgt = hgt;
+    this->yrat = (floor_height + hgt - 1) / hgt;
+    this->xrat = (floor_width + wid - 1) / wid;
+
+    const auto grid_num = (floor_height + 2) * (floor_width + 2);
+    this->grid_symbols.assign(grid_num, DisplaySymbol(TERM_WHITE, ' '));
+    this->grid_priorities.assign(grid_num, 0);
+    this->grid_match_autopicks.assign(grid_num, -1);
+    this->grid_autopick_items.assign(grid_num, nullptr);
+    this->effective_priorities.assign(grid_num, 0);
+    this->is_dirty_grids.assign(grid_num, false);
+    this->dirty_positions.clear();
+
+    const auto cell_num = (hgt + 2) * (wid + 2);
+    this->symbols.assign(cell_num, DisplaySymbol(TERM_WHITE, ' '));
+    this->match_autopicks.assign(cell_num, -1);
+    this->autopick_items.assign(cell_num, nullptr);
+    this->is_dirty_cells.assign(cell_num, false);
+
+    const auto bottom = hgt + 1;
+    const auto right = wid + 1;
+    for (auto x = 1; x <= wid; x++) {
+        this->symbols[this->cell_index(0, x)].character = '-';
+        this->symbols[this->cell_index(bottom, x)].character = '-';
+    }
+
+    for (auto y = 1; y <= hgt; y++) {
+        this->symbols[this->cell_index(y, 0)].character = '|';
+        this->symbols[this->cell_index(y, right)].character = '|';
+    }
+
+    this->symbols[this->cell_index(0, 0)].character = '+';
+    this->symbols[this->cell_index(0, right)].character = '+';
+    this->symbols[this->cell_index(bottom, 0)].character = '+';
+    this->symbols[this->cell_index(bottom, right)].character = '+';
+    this->is_all_dirty = true;
+}
+
+int OverheadMapCache::grid_index(int y, int x) const
+{
+    return (y + 1) * (this->floor_width + 2) + (x + 1);
+}
+
+int OverheadMapCache::cell_index(int y, int x) const
+{
+    return y * (this->wid + 2) + x;
+}
+
+void OverheadMapCache::update_grid(PlayerType *player_ptr, const Pos2D &pos)
+{
+    match_autopick = -1;
+    autopick_obj = nullptr;
+    feat_priority = -1;
+    const auto symbol_pair = map_info(player_ptr, pos);
+    const auto index = this->grid_index(pos.y, pos.x);
+    this->grid_symbols[index] = symbol_pair.symbol_foreground;
+    this->grid_priorities[index] = static_cast<byte>(feat_priority);
+    this->grid_match_autopicks[index] = match_autopick;
+    this->grid_autopick_items[index] = autopick_obj;
+}
+
+/*!
+ * @brief 縮小マップの1マスに入るグリッドから、表示するグリッドを選ぶ
+ * @param y 縮小マップの行
+ * @param x 縮小マップの桁
+ * @details 自動拾いに一致したアイテムのあるグリッドを優先し、次いで地形の優先度の高いグリッドを選ぶ.
+ * 優先度が同じならば周囲と異なる表示のグリッドを優先する.
+ */
+void OverheadMapCache::update_cell(int y, int x)
+{
+    const auto y_begin = (y - 1) * this->yrat;
+    const auto y_end = std::min(y * this->yrat, this->floor_height);
+    const auto x_begin = (x - 1) * this->xrat;
+    const auto x_end = std::min(x * this->xrat, this->floor_width);
+
+    auto match = -1;
+    const ItemEntity *item = nullptr;
+    for (auto i = x_begin; i < x_end; i++) {
+        for (auto j = y_begin; j < y_end; j++) {
+            const auto index = this->grid_index(j, i);
+            auto priority = this->grid_priorities[index];
+            const auto grid_match = this->grid_match_autopicks[index];
+            if ((grid_match != -1) && ((match == -1) || (match > grid_match))) {
+                match = grid_match;
+                item = this->grid_autopick_items[index];
+                priority = 0x7f;
+            }
+
+            this->effective_priorities[index] = priority;
+        }
+    }
+
+    DisplaySymbol symbol(TERM_WHITE, ' ');
+    byte cell_priority = 0;
+    for (auto j = y_begin; j < y_end; j++) {
+        for (auto i = x_begin; i < x_end; i++) {
+            const auto index = this->grid_index(j, i);
+            const auto &grid_symbol = this->grid_symbols[index];
+            auto priority = this->effective_priorities[index];
+            if (cell_priority == priority) {
+                auto cnt = 0;
+                for (const auto &d : Direction::directions_8()) {
+                    const auto vec = d.vec();
+                    if (grid_symbol == this->grid_symbols[this->grid_index(j + vec.y, i + vec.x)]) {
+                        cnt++;
+                    }
+                }
+
+                if (cnt <= 4) {
+                    priority++;
+                }
+            }
+
+            if (cell_priority < priority) {
+                symbol = grid_symbol;
+                cell_priority = priority;
+            }
+        }
+    }
+
+    const auto index = this->cell_index(y, x);
+    this->symbols[index] = symbol;
+    this->match_autopicks[index] = match;
+    this->autopick_items[index] = item;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+/*!
+ * @file overhead-map-cache.h
+ * @brief 縮小マップの表示内容のキャッシュ
+ */
+
+#include "system/angband.h"
+#include "util/point-2d.h"
+#include "view/display-symbol.h"
+#include <vector>
+
+class ItemEntity;
+class PlayerType;
+
+/*!
+ * @brief 縮小マップの表示内容のキャッシュ
+ * @details フロアの各グリッドの map_info() の結果と、それを縮小した各マスの表示内容を保持する.
+ * 表示の変わったグリッドは lite_spot() / note_spot() が通知するので、更新時はそのグリッドと、
+ * そのグリッドを隣接グリッドとして参照する縮小マップのマスだけを計算し直す.
+ * マップ全体の再描画 (MainWindowRedrawingFlag::MAP) が必要な時や、フロア・表示領域の大きさが変わった時は全体を計算し直す.
+ */
+class OverheadMapCache {
+public:
+    OverheadMapCache(const OverheadMapCache &) = delete;
+    OverheadMapCache(OverheadMapCache &&) = delete;
+    OverheadMapCache &operator=(const OverheadMapCache &) = delete;
+    OverheadMapCache &operator=(OverheadMapCache &&) = delete;
+    static OverheadMapCache &get_instance();
+
+    void set_dirty(const Pos2D &pos);
+    void set_all_dirty();
+    void update(PlayerType *player_ptr, int wid, int hgt);
+    int get_y_ratio() const;
+    int get_x_ratio() const;
+    const DisplaySymbol &get_symbol(int y, int x) const;
+    int get_match_autopick(int y, int x) const;
+    const ItemEntity *get_autopick_item(int y, int x) const;
+
+private:
+    OverheadMapCache() = default;
+
+    int floor_width = 0;
+    int floor_height = 0;
+    int wid = 0; //!< 縮小マップの桁数 (枠線を除く)
+    int hgt = 0; //!< 縮小マップの行数 (枠線を除く)
+    int yrat = 1; //!< 縮小マップの1マスに入るグリッドの行数
+    int xrat = 1; //!< 縮小マップの1マスに入るグリッドの桁数
+    byte display_autopick = 0; //!< 計算した時の自動拾い表示の設定
+    bool is_all_dirty = true;
+
+    /* フロアのグリッドごとの内容. 周囲1グリッドの余白を含めて (floor_height + 2) * (floor_width + 2) */
+    std::vector<DisplaySymbol> grid_symbols;
+    std::vector<byte> grid_priorities;
+    std::vector<int> grid_match_autopicks;
+    std::vector<const ItemEntity *> grid_autopick_items;
+    std::vector<byte> effective_priorities; //!< 自動拾いの一致を反映した優先度 (作業用)
+    std::vector<bool> is_dirty_grids;
+    std::vector<Pos2D> dirty_positions;
+
+    /* 縮小マップのマスごとの内容. 枠線を含めて (hgt + 2) * (wid + 2) */
+    std::vector<DisplaySymbol> symbols;
+    std::vector<int> match_autopicks;
+    std::vector<const ItemEntity *> autopick_items;
+    std::vector<bool> is_dirty_cells;
+
+    void resize(int floor_width, int floor_height, int wid, int hgt);
+    int grid_index(int y, int x) const;
+    int cell_index(int y, int x) const;
+    void update_grid(PlayerType *player_ptr, const Pos2D &pos);
+    void update_cell(int y, int x);
+};
@@ -42,6 +42,7 @@
 #include "term/screen-processor.h"
 #include "term/term-color-types.h"
 #include "util/bit-flags-calculator.h"
+#include "util/trace.h"
 #include "view/display-messages.h"
 #include "window/main-window-row-column.h"
 #include "world/world-movement-processor.h"
@@ -60,6 +61,7 @@ WorldTurnProcessor::WorldTurnProcessor(PlayerType *player_ptr)
  */
 void WorldTurnProcessor::process_world()
 {
+    TRACE_SCOPE("process_world");
     const int a_day = TURNS_PER_TICK * TOWN_DAWN;
     const auto &world = AngbandWorld::get_instance();
     const int prev_turn_in_today = ((world.game_turn - TURNS_PER_TICK) % a_day + a_day / 4) % a_day;